@@ -0,0 +1,136 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "Main.hpp"
+#include <Langulus/Platform.hpp>
+#include <Flow/Verbs/Interact.hpp>
+#include "../source/Window.hpp"
+#include <catch2/catch.hpp>
+
+using namespace GLFW;
+
+
+/// See https://github.com/catchorg/Catch2/blob/devel/docs/tostring.md        
+CATCH_TRANSLATE_EXCEPTION(::Langulus::Exception const& ex) {
+   const Text serialized {ex};
+   return ::std::string {Token {serialized}};
+}
+
+/// A unit that handles every event it receives, so that events are really    
+/// dispatched, even if a window filters unhandled event types                
+struct Listener final : A::Unit {
+   LANGULUS(ABSTRACT) false;
+   LANGULUS_BASES(A::Unit);
+   LANGULUS_VERBS(Verbs::Interact);
+
+   void Interact(Verb& verb) {
+      verb.Done();
+   }
+};
+
+/// Create a number of focused windows inside an entity                       
+///   @param root - the entity to create windows in                           
+///   @param count - number of windows to create                              
+///   @return the created windows                                             
+TMany<GLFW::Window*> CreateWindows(Thing& root, Count count) {
+   TMany<GLFW::Window*> windows;
+   for (Count i = 0; i < count; ++i) {
+      auto window = root.CreateUnit<A::Window>();
+      auto glfw = static_cast<GLFW::Window*>(window.As<A::Window*>());
+      glfw->Capture({RawEvent::Focus, GLFW_TRUE});
+      windows << glfw;
+   }
+
+   root.Update({});
+   return windows;
+}
+
+SCENARIO("Event dispatch", "[bench]") {
+   Listener listener;
+   auto root = Thing::Root<false>("GLFW");
+   root.AddUnit(&listener);
+   auto window = CreateWindows(root, 1)[0];
+
+   // Dispatch cost per event is the difference between these divided   
+   // by the difference in event count                                  
+   for (int events : {1, 16, 256}) {
+      BENCHMARK("Callback to dispatch, " + ::std::to_string(events) + " events") {
+         for (int i = 0; i < events; ++i) {
+            window->Capture({
+               RawEvent::Key, GLFW_KEY_A + i % 26, 0, GLFW_PRESS, 0
+            });
+         }
+         return root.Update({});
+      };
+   }
+
+   root.RemoveUnit(&listener);
+}
+
+SCENARIO("Platform update", "[bench]") {
+   for (Count count : {1, 10, 100}) {
+      auto root = Thing::Root<false>("GLFW");
+      CreateWindows(root, count);
+
+      BENCHMARK("Platform update, " + ::std::to_string(count) + " windows") {
+         return root.Update({});
+      };
+   }
+}
+
+SCENARIO("Platform update with closed windows", "[bench]") {
+   // Only open windows should contribute to the cost of a frame, no    
+   // matter how many windows were created in total                     
+   for (Count open : {1, 10, 100}) {
+      auto root = Thing::Root<false>("GLFW");
+      auto windows = CreateWindows(root, 100);
+      for (Count i = open; i < windows.GetCount(); ++i)
+         windows[i]->Capture({RawEvent::Closed});
+      root.Update({});
+
+      BENCHMARK("Platform update, " + ::std::to_string(open)
+         + " of 100 windows open") {
+         return root.Update({});
+      };
+   }
+}
+
+SCENARIO("Window lifetime", "[bench]") {
+   auto root = Thing::Root<false>("GLFW");
+
+   BENCHMARK("Window create and destroy") {
+      auto window = root.CreateUnit<A::Window>();
+      return root.RemoveUnits<A::Window>();
+   };
+}
+
+SCENARIO("Window queries", "[bench]") {
+   auto root = Thing::Root<false>("GLFW");
+   auto window = CreateWindows(root, 1)[0];
+
+   BENCHMARK("Clipboard read") {
+      return window->GetClipboard().GetCount();
+   };
+
+   BENCHMARK("Clipboard read after focus change") {
+      window->Capture({RawEvent::Focus, GLFW_FALSE});
+      window->Capture({RawEvent::Focus, GLFW_TRUE});
+      root.Update({});
+      return window->GetClipboard().GetCount();
+   };
+
+   BENCHMARK("State queries") {
+      return window->IsInteractable() and window->IsMouseOver();
+   };
+
+   // Attribute queries aren't timed, because they are expected to happen
+   // only on window creation - report how many happen per frame instead
+   const auto queries = window->GetAttributeQueries();
+   for (int frame = 0; frame < 100; ++frame)
+      root.Update({});
+   CHECK(window->GetAttributeQueries() == queries);
+}
@@ -0,0 +1,18 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "Main.hpp"
+
+#define CATCH_CONFIG_RUNNER
+#include <catch2/catch.hpp>
+
+LANGULUS_RTTI_BOUNDARY(RTTI::MainBoundary)
+
+int main(int argc, char* argv[]) {
+   Catch::Session session;
+   return session.run(argc, argv);
+}
@@ -0,0 +1,13 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include <Langulus.hpp>
+
+using namespace Langulus;
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
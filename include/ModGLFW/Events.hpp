@@ -0,0 +1,117 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+/// Events and data produced by the GLFW module, that aren't covered by the   
+/// abstract platform events. Include this to handle them                     
+///                                                                           
+#pragma once
+#include <Langulus/Platform.hpp>
+#include <chrono>
+
+
+namespace GLFW
+{
+   using namespace Langulus;
+
+
+   ///                                                                        
+   ///   Dropped file metadata                                                
+   ///                                                                        
+   struct DroppedFile {
+      LANGULUS(NAME) "GLFW::DroppedFile";
+      LANGULUS(INFO) "Metadata of a dropped file";
+      LANGULUS(POD) true;
+
+      // Whether the file still exists at the time it was resolved      
+      bool mExists = false;
+      // Whether the path is a directory                                
+      bool mDirectory = false;
+      // File size in bytes, zero for directories                       
+      ::std::uint64_t mSize = 0;
+   };
+
+   ///                                                                        
+   ///   Dropped files metadata event                                         
+   ///                                                                        
+   /// Follows each Events::WindowFileDrop in the same interact verb, with    
+   /// the metadata of its paths, in the same order. Paths that no longer     
+   /// exist are still delivered, and are marked as such here                 
+   ///                                                                        
+   struct WindowFileInfo {
+      LANGULUS(NAME) "GLFW::WindowFileInfo";
+      LANGULUS(INFO) "Metadata of the files in the preceding file drop";
+
+      TMany<DroppedFile> mFiles;
+   };
+
+   ///                                                                        
+   ///   Event timing                                                         
+   ///                                                                        
+   /// Always the last argument of the interact verbs a window dispatches,    
+   /// so that handlers can measure input latency. Holds how long each of     
+   /// the preceding events waited between being received from the OS and     
+   /// being dispatched, in the same order                                    
+   ///                                                                        
+   struct EventTiming {
+      LANGULUS(NAME) "GLFW::EventTiming";
+      LANGULUS(INFO) "Latency of the events in the same interact verb";
+
+      // When the verb was dispatched                                   
+      ::std::chrono::steady_clock::time_point mDispatchTime;
+      // Time from capture to dispatch, for each of the preceding events
+      TMany<Time> mLatency;
+   };
+
+   ///                                                                        
+   ///   Gamepad button was pressed or released                               
+   ///                                                                        
+   /// Buttons are indexed as GLFW_GAMEPAD_BUTTON_*                           
+   ///                                                                        
+   struct GamepadButton {
+      LANGULUS(NAME) "GLFW::GamepadButton";
+      LANGULUS(INFO) "Gamepad button was pressed or released";
+      LANGULUS(POD) true;
+
+      // Joystick index of the gamepad                                  
+      int mGamepad = 0;
+      int mButton = 0;
+      bool mPressed = false;
+   };
+
+   ///                                                                        
+   ///   Gamepad axis has moved                                               
+   ///                                                                        
+   /// Axes are indexed as GLFW_GAMEPAD_AXIS_* - sticks rest at zero, and     
+   /// triggers rest at -1                                                    
+   ///                                                                        
+   struct GamepadAxis {
+      LANGULUS(NAME) "GLFW::GamepadAxis";
+      LANGULUS(INFO) "Gamepad axis has moved";
+      LANGULUS(POD) true;
+
+      // Joystick index of the gamepad                                  
+      int mGamepad = 0;
+      int mAxis = 0;
+      float mValue = 0;
+      // Change since the previous event for the same axis              
+      float mDelta = 0;
+   };
+
+   ///                                                                        
+   ///   Gamepad was connected or disconnected                                
+   ///                                                                        
+   struct GamepadConnection {
+      LANGULUS(NAME) "GLFW::GamepadConnection";
+      LANGULUS(INFO) "Gamepad was connected or disconnected";
+      LANGULUS(POD) true;
+
+      // Joystick index of the gamepad                                  
+      int mGamepad = 0;
+      bool mConnected = false;
+   };
+
+} // namespace GLFW
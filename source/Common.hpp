@@ -7,6 +7,7 @@
 ///                                                                           
 #pragma once
 #include <Langulus/Platform.hpp>
+#include "../include/ModGLFW/Events.hpp"
 
 
 namespace GLFW
@@ -19,6 +20,56 @@ namespace GLFW
    struct Window;
 }
 
+/// Enables polling of OS events on a dedicated thread, when provided in the  
+/// module descriptor. Supported only on X11 and the headless backend - on    
+/// other platforms, events must be polled on the main thread, so the trait   
+/// is ignored with a warning                                                 
+LANGULUS_DEFINE_TRAIT(ThreadedInput,
+   "Whether or not OS events are polled on a dedicated thread");
+
+/// Makes the module wait for OS events on update, instead of polling them,   
+/// when provided in the module descriptor. Use true to wait indefinitely,    
+/// or a Time to wait with a timeout                                          
+LANGULUS_DEFINE_TRAIT(WaitEvents,
+   "Whether or not to wait for OS events on update, and for how long");
+
+/// Makes the module use a null backend, when provided in the module          
+/// descriptor. Windows are still produced, but aren't backed by the OS, and  
+/// receive only synthetic events. Can be enabled via the environment, too    
+LANGULUS_DEFINE_TRAIT(Headless,
+   "Whether or not to run without a display, using a null backend");
+
+/// Records all input of a window to the given file, when provided in the     
+/// window descriptor                                                         
+LANGULUS_DEFINE_TRAIT(RecordInput,
+   "File to record all raw input of a window to");
+
+/// Replays input to a window from the given file, when provided in the       
+/// window descriptor                                                         
+LANGULUS_DEFINE_TRAIT(ReplayInput,
+   "File to replay raw input of a window from");
+
+/// Captures the mouse, and reports unaccelerated relative motion instead of  
+/// cursor movement, when provided in the window descriptor or associated     
+LANGULUS_DEFINE_TRAIT(RelativeMouse,
+   "Whether or not mouse is captured, reporting relative motion");
+
+/// Delays resize and resolution change events until the window size didn't   
+/// change for the given Time, when provided in the window descriptor         
+LANGULUS_DEFINE_TRAIT(ResizeDebounce,
+   "How long window size must settle, before resize events are delivered");
+
+/// Drops events of types that nothing handled when first dispatched, when    
+/// provided in the window descriptor or associated. Off by default, because  
+/// only units that mark the interact verb done count as handling an event    
+LANGULUS_DEFINE_TRAIT(FilterUnhandled,
+   "Whether or not events nothing handled are dropped before dispatch");
+
+/// Held keys and mouse buttons of a window, with the ones pressed and        
+/// released since the last update, as a GLFW::ButtonState                    
+LANGULUS_DEFINE_TRAIT(ButtonState,
+   "Packed bitsets of held, pressed and released keys and mouse buttons");
+
 #if 0
    #define VERBOSE_GLFW(...)     Logger::Verbose(Self(), __VA_ARGS__)
    #define VERBOSE_GLFW_TAB(...) const auto tab = Logger::VerboseTab(Self(), __VA_ARGS__)
@@ -13,14 +13,67 @@ namespace GLFW
 {
 
    /// Cursor construction                                                    
+   /// A standard shape can be picked by name, otherwise it is an arrow       
    ///   @param producer - cursor owner                                       
    ///   @param descriptor - cursor descriptor                                
    Cursor::Cursor(GLFW::Platform* producer, Describe descriptor)
       : Resolvable   {this}
       , ProducedFrom {producer, descriptor} {
       VERBOSE_GLFW("Initializing...");
+
+      Text name;
+      if (SeekValueAux<Traits::Name>(descriptor, name)) {
+         for (Count i = 0; i < StandardCount; ++i) {
+            if (name == StandardNames[i]) {
+               mShape = GLFW_ARROW_CURSOR + static_cast<int>(i);
+               break;
+            }
+         }
+      }
+
       Couple(descriptor);
       VERBOSE_GLFW("Initialized");
    }
 
+   /// Use one of the standard cursor shapes                                  
+   ///   @param shape - the GLFW cursor shape, like GLFW_IBEAM_CURSOR         
+   void Cursor::SetShape(int shape) noexcept {
+      mShape = shape;
+      mImage = {};
+      mCached = {};
+   }
+
+   /// Use a custom cursor image                                              
+   ///   @param rgba - the pixels, 8 bits per channel, top to bottom          
+   ///   @param w - image width                                               
+   ///   @param h - image height                                              
+   ///   @param hotX - hotspot, relative to the left edge of the image        
+   ///   @param hotY - hotspot, relative to the top edge of the image         
+   void Cursor::SetImage(const void* rgba, int w, int h, int hotX, int hotY) {
+      const auto bytes = static_cast<const unsigned char*>(rgba);
+      mImage.mPixels.assign(bytes, bytes + w * h * 4);
+      mImage.mSize[0] = w;
+      mImage.mSize[1] = h;
+      mImage.mHotspot[0] = hotX;
+      mImage.mHotspot[1] = hotY;
+      mImage.mHash = HashOf(Token {
+         reinterpret_cast<const char*>(bytes), mImage.mPixels.size()
+      }, w, h, hotX, hotY);
+      mCached = {};
+   }
+
+   /// Get the native cursor from the platform cache                          
+   /// Custom cursors are looked up only if they might have been evicted      
+   /// since the last time, otherwise the remembered handle is reused         
+   ///   @return the native cursor                                            
+   GLFWcursor* Cursor::GetHandle() const {
+      const auto producer = GetProducer();
+      if (mImage.mPixels.empty())
+         return producer->GetStandardCursor(mShape);
+
+      if (not producer->UseCustomCursor(mCached))
+         mCached = producer->GetCustomCursor(mImage);
+      return mCached.mHandle;
+   }
+
 } // namespace GLFW
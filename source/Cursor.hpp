@@ -12,18 +12,67 @@
 namespace GLFW
 {
 
+   ///                                                                        
+   ///   Custom cursor image                                                  
+   ///                                                                        
+   struct CursorImage {
+      // RGBA pixels, 8 bits per channel, top to bottom                 
+      ::std::vector<unsigned char> mPixels;
+      int mSize[2] {};
+      int mHotspot[2] {};
+      // Hash of the pixels, size and hotspot, used as the cache key    
+      Hash mHash;
+   };
+
+   ///                                                                        
+   ///   A custom cursor's place in the platform cache                        
+   ///                                                                        
+   /// Valid only while the cache generation doesn't change, which happens    
+   /// whenever a cached cursor is evicted                                    
+   ///                                                                        
+   struct CachedCursorSlot {
+      GLFWcursor* mHandle {};
+      Offset mIndex {};
+      Count mGeneration {};
+   };
+
+
    ///                                                                        
    ///   GLFW cursor                                                          
    ///                                                                        
+   /// Either one of the standard cursor shapes, or a custom image. The       
+   /// native cursors are owned and cached by the platform, so applying a     
+   /// cursor to a window never uploads an image, unless it was evicted       
+   ///                                                                        
    struct Cursor final : A::Platform, ProducedFrom<GLFW::Platform> {
       LANGULUS(ABSTRACT) false;
       LANGULUS(PRODUCER) GLFW::Platform;
       LANGULUS_BASES(A::Platform);
 
+      // Standard cursor shapes, in the order of the GLFW shape constants
+      static constexpr Count StandardCount = 10;
+      static constexpr Token StandardNames[StandardCount] {
+         "Arrow", "IBeam", "Crosshair", "Hand", "ResizeEW",
+         "ResizeNS", "ResizeNWSE", "ResizeNESW", "ResizeAll", "NotAllowed"
+      };
+
+   private:
+      // Standard cursor shape, if there's no custom image              
+      int mShape = GLFW_ARROW_CURSOR;
+      // Custom cursor image, if any                                    
+      CursorImage mImage;
+      // Where the custom cursor is in the platform cache, so that it   
+      // isn't looked up again, unless it might have been evicted       
+      mutable CachedCursorSlot mCached;
+
    public:
       Cursor(GLFW::Platform*, Describe);
 
       void Refresh() final {}
+
+      void SetShape(int) noexcept;
+      void SetImage(const void* rgba, int w, int h, int hotX = 0, int hotY = 0);
+      NOD() GLFWcursor* GetHandle() const;
    };
 
-} // namespace GLFW
\ No newline at end of file
+} // namespace GLFW
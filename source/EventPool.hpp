@@ -0,0 +1,83 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Common.hpp"
+#include <utility>
+#include <vector>
+
+
+namespace GLFW
+{
+
+   ///                                                                        
+   ///   Event payload pool                                                   
+   ///                                                                        
+   /// Keeps type-erased event containers alive between dispatches, so that   
+   /// queuing an event overwrites an idle container of the same type,        
+   /// instead of allocating a new one. A container is idle when the pool     
+   /// holds the only reference to it, which is the case once the interact    
+   /// verb that carried it is gone, and the event list is cleared            
+   ///                                                                        
+   struct EventPool {
+      // Containers beyond this limit per type are not pooled, in case  
+      // something keeps referencing events for long                    
+      static constexpr Count SlotLimit = 64;
+
+   private:
+      ::std::vector<::std::pair<DMeta, ::std::vector<Many>>> mSlots;
+      // Number of new containers made, for profiling purposes          
+      Count mAllocations = 0;
+
+   public:
+      template<class E>
+      void Push(TMany<Many>&, E&&);
+
+      NOD() Count GetAllocations() const noexcept {
+         return mAllocations;
+      }
+   };
+
+
+   /// Queue an event, reusing an idle container of the same type             
+   ///   @param events - [out] the event list to push to                      
+   ///   @param event - the event to push                                     
+   template<class E> LANGULUS(INLINED)
+   void EventPool::Push(TMany<Many>& events, E&& event) {
+      using D = Decay<E>;
+      const auto type = MetaDataOf<D>();
+
+      ::std::vector<Many>* slots = nullptr;
+      for (auto& [known, list] : mSlots) {
+         if (known == type) {
+            slots = &list;
+            break;
+         }
+      }
+
+      if (not slots)
+         slots = &mSlots.emplace_back(type, ::std::vector<Many> {}).second;
+
+      for (auto& slot : *slots) {
+         if (slot.GetUses() == 1) {
+            slot.template As<D>() = Forward<E>(event);
+            events << slot;
+            return;
+         }
+      }
+
+      ++mAllocations;
+      if (slots->size() == SlotLimit) {
+         events << Many {Forward<E>(event)};
+         return;
+      }
+
+      slots->emplace_back(Many {Forward<E>(event)});
+      events << slots->back();
+   }
+
+} // namespace GLFW
@@ -0,0 +1,77 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "FileDrop.hpp"
+#include <algorithm>
+#include <filesystem>
+
+
+namespace GLFW
+{
+
+   /// Start resolving the metadata of all paths on another thread            
+   void FileDrop::Resolve() {
+      mFiles.resize(mOffsets.size());
+      mResolver = ::std::async(::std::launch::async, [this] {
+         namespace fs = ::std::filesystem;
+         for (Offset i = 0; i < mOffsets.size(); ++i) {
+            if (mCancelled.load(::std::memory_order_relaxed))
+               return;
+
+            ::std::error_code error;
+            const fs::path path {mArena.data() + mOffsets[i]};
+            const auto status = fs::status(path, error);
+            auto& file = mFiles[i];
+            file.mExists = not error and fs::exists(status);
+            file.mDirectory = fs::is_directory(status);
+            if (file.mExists and fs::is_regular_file(status)) {
+               const auto size = fs::file_size(path, error);
+               file.mSize = error ? 0 : size;
+            }
+
+            mResolved.store(i + 1, ::std::memory_order_release);
+         }
+      });
+   }
+
+   /// Get the number of resolved, but not yet delivered paths                
+   Count FileDrop::GetReady() const noexcept {
+      return mResolved.load(::std::memory_order_acquire) - mDelivered;
+   }
+
+   /// Check if all paths were delivered                                      
+   bool FileDrop::IsDelivered() const noexcept {
+      return mDelivered == mOffsets.size();
+   }
+
+   /// Get a path as a view into the arena                                    
+   ///   @param index - the path index                                        
+   ///   @return the path, without the terminator                             
+   Token FileDrop::GetPath(Offset index) const noexcept {
+      const auto begin = mOffsets[index];
+      const auto end = index + 1 < mOffsets.size()
+         ? mOffsets[index + 1] - 1 : mArena.size() - 1;
+      return {mArena.data() + begin, end - begin};
+   }
+
+   /// Get the metadata of a resolved path                                    
+   ///   @param index - the path index                                        
+   ///   @return the metadata                                                 
+   const DroppedFile& FileDrop::GetFile(Offset index) const noexcept {
+      return mFiles[index];
+   }
+
+   /// Mark a number of resolved paths as delivered                           
+   ///   @param count - maximum number of paths to deliver                    
+   ///   @return the index of the first delivered path                        
+   Offset FileDrop::Deliver(Count count) noexcept {
+      const auto first = mDelivered;
+      mDelivered += ::std::min(count, GetReady());
+      return first;
+   }
+
+} // namespace GLFW
@@ -0,0 +1,104 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Common.hpp"
+#include <atomic>
+#include <cstring>
+#include <future>
+#include <string>
+#include <vector>
+
+
+namespace GLFW
+{
+
+   ///                                                                        
+   ///   A set of dropped files                                               
+   ///                                                                        
+   /// All paths of a drop are packed in a single arena, NUL-terminated and   
+   /// addressed by offset, so that capturing a drop of any size costs two    
+   /// allocations. The metadata of each path is resolved in the background,  
+   /// and paths are delivered in chunks, as their metadata becomes ready     
+   ///                                                                        
+   struct FileDrop {
+      // Maximum number of paths delivered in a single event            
+      static constexpr Count ChunkSize = 1024;
+
+   private:
+      // All paths, NUL-terminated, one after another                   
+      ::std::string mArena;
+      // Offset of each path inside the arena                           
+      ::std::vector<Offset> mOffsets;
+      // Metadata of each path, filled in the background                
+      ::std::vector<DroppedFile> mFiles;
+      // Number of paths with resolved metadata                         
+      ::std::atomic<Count> mResolved = 0;
+      // Set to abort the background pass early                         
+      ::std::atomic<bool> mCancelled = false;
+      ::std::future<void> mResolver;
+      // Number of paths already delivered                              
+      Offset mDelivered = 0;
+
+   public:
+      FileDrop(int count, const char** paths);
+      FileDrop(const FileDrop&) = delete;
+      ~FileDrop();
+
+      void Resolve();
+      NOD() Count GetCount() const noexcept;
+      NOD() Count GetReady() const noexcept;
+      NOD() bool IsDelivered() const noexcept;
+      NOD() Token GetPath(Offset) const noexcept;
+      NOD() const DroppedFile& GetFile(Offset) const noexcept;
+      NOD() const ::std::string& GetArena() const noexcept;
+      Offset Deliver(Count) noexcept;
+   };
+
+
+   /// Pack the dropped paths into the arena                                  
+   /// Called from inside the GLFW callback, so it only copies memory         
+   ///   @param count - number of dropped files                               
+   ///   @param paths - the dropped file paths, valid only during the callback
+   LANGULUS(INLINED)
+   FileDrop::FileDrop(int count, const char** paths) {
+      Count bytes = 0;
+      for (int i = 0; i < count; ++i)
+         bytes += ::std::strlen(paths[i]) + 1;
+
+      mArena.reserve(bytes);
+      mOffsets.reserve(count);
+      for (int i = 0; i < count; ++i) {
+         mOffsets.push_back(mArena.size());
+         mArena.append(paths[i]);
+         mArena.push_back('\0');
+      }
+   }
+
+   /// Wait for the background pass to finish, aborting it early              
+   /// Inlined along with the constructor, because drops are captured, and    
+   /// destroyed, by code outside the module, too                             
+   LANGULUS(INLINED)
+   FileDrop::~FileDrop() {
+      mCancelled = true;
+      if (mResolver.valid())
+         mResolver.wait();
+   }
+
+   /// Get the number of paths in the drop                                    
+   LANGULUS(INLINED)
+   Count FileDrop::GetCount() const noexcept {
+      return mOffsets.size();
+   }
+
+   /// Get the packed paths, NUL-terminated, one after another                
+   LANGULUS(INLINED)
+   const ::std::string& FileDrop::GetArena() const noexcept {
+      return mArena;
+   }
+
+} // namespace GLFW
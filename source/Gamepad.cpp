@@ -0,0 +1,128 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "Gamepad.hpp"
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+
+namespace GLFW
+{
+
+   /// Find out which joysticks are connected gamepads                        
+   /// Call on startup, and again when a joystick is connected or disconnected
+   void Gamepads::Scan() {
+      mConnected = 0;
+      for (int pad = 0; pad < static_cast<int>(Max); ++pad) {
+         if (glfwJoystickIsGamepad(pad))
+            mConnected |= 1u << pad;
+      }
+   }
+
+   /// Poll all connected gamepads, and produce events for the changes        
+   /// Gamepads that appeared or disappeared since the last poll also produce 
+   /// a connection event                                                     
+   ///   @param events - [out] the produced events                            
+   ///   @param pool - the pool to reuse event containers from                
+   void Gamepads::Poll(TMany<Many>& events, EventPool& pool) {
+      if (not mConnected and not mPolled)
+         return;
+
+      for (int pad = 0; pad < static_cast<int>(Max); ++pad) {
+         const auto bit = 1u << pad;
+         auto& previous = mStates[pad];
+
+         GLFWgamepadstate raw;
+         if (not (mConnected & bit) or not glfwGetGamepadState(pad, &raw)) {
+            if (mPolled & bit) {
+               mPolled &= ~bit;
+               previous = {};
+               pool.Push(events, GamepadConnection {pad, false});
+            }
+            continue;
+         }
+
+         State current;
+         ::std::memcpy(current.mButtons.data(), raw.buttons,
+            sizeof(raw.buttons));
+
+         // Filter out stick drift and sensor jitter, so that the state 
+         // of a gamepad nobody touches stays bit-identical. Changes    
+         // below the epsilon keep the previous value, so that slow     
+         // motion still accumulates into an event eventually           
+         for (int axis = 0; axis <= GLFW_GAMEPAD_AXIS_LAST; ++axis) {
+            const float rest = axis >= GLFW_GAMEPAD_AXIS_LEFT_TRIGGER
+               ? -1.0f : 0.0f;
+            auto value = raw.axes[axis];
+            if (::std::abs(value - rest) < AxisDeadzone)
+               value = rest;
+            if (::std::abs(value - previous.mAxes[axis]) < AxisEpsilon
+            and value != rest)
+               value = previous.mAxes[axis];
+            current.mAxes[axis] = value;
+         }
+
+         if (not (mPolled & bit)) {
+            mPolled |= bit;
+            pool.Push(events, GamepadConnection {pad, true});
+         }
+
+         // Idle gamepads are rejected with a single compare            
+         if (0 == ::std::memcmp(&current, &previous, sizeof(State)))
+            continue;
+
+         // Compare buttons eight at a time                             
+         for (Offset word = 0; word < 2; ++word) {
+            ::std::uint64_t now, before;
+            ::std::memcpy(&now, current.mButtons.data() + word * 8, 8);
+            ::std::memcpy(&before, previous.mButtons.data() + word * 8, 8);
+
+            auto changed = now ^ before;
+            while (changed) {
+               const auto byte = ::std::countr_zero(changed) / 8;
+               const auto button = static_cast<int>(word * 8 + byte);
+               pool.Push(events, GamepadButton {
+                  pad, button, current.mButtons[button] == GLFW_PRESS
+               });
+               changed &= ~(::std::uint64_t {0xFF} << (byte * 8));
+            }
+         }
+
+         for (int axis = 0; axis <= GLFW_GAMEPAD_AXIS_LAST; ++axis) {
+            const auto value = current.mAxes[axis];
+            const auto delta = value - previous.mAxes[axis];
+            if (delta)
+               pool.Push(events, GamepadAxis {pad, axis, value, delta});
+         }
+
+         previous = current;
+      }
+   }
+
+   /// Check if a joystick is a connected gamepad                             
+   ///   @param pad - the joystick index                                      
+   ///   @return true if joystick is a connected gamepad                      
+   bool Gamepads::IsConnected(int pad) const noexcept {
+      return pad >= 0 and pad < static_cast<int>(Max)
+         and (mConnected & (1u << pad));
+   }
+
+   /// Check if any gamepad is connected                                      
+   ///   @return true if at least one joystick is a connected gamepad         
+   bool Gamepads::IsAnyConnected() const noexcept {
+      return mConnected != 0;
+   }
+
+   /// Get the last polled state of a gamepad                                 
+   ///   @param pad - the joystick index                                      
+   ///   @return the state                                                    
+   const Gamepads::State& Gamepads::GetState(int pad) const noexcept {
+      return mStates[pad];
+   }
+
+} // namespace GLFW
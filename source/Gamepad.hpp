@@ -0,0 +1,66 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "EventPool.hpp"
+#include <array>
+
+
+namespace GLFW
+{
+
+   ///                                                                        
+   ///   Gamepad poller                                                       
+   ///                                                                        
+   /// Keeps the state of all gamepads in a contiguous array, and compares    
+   /// it to the previous poll in bulk, so that events are produced only for  
+   /// buttons and axes that have changed, and idle gamepads cost a compare   
+   ///                                                                        
+   struct Gamepads {
+      static constexpr Count Max = GLFW_JOYSTICK_LAST + 1;
+      // Axes closer than this to their rest position are considered at 
+      // rest - sticks rest at zero, and triggers at -1                 
+      static constexpr float AxisDeadzone = 0.08f;
+      // Axis changes smaller than this are considered noise, and don't 
+      // produce events                                                 
+      static constexpr float AxisEpsilon = 1.0f / 128;
+
+      ///                                                                     
+      /// State of a single gamepad, padded to whole words                    
+      /// Defaults to the rest state, so that gamepads that connect with      
+      /// untouched triggers don't produce any axis events                    
+      ///                                                                     
+      struct alignas(16) State {
+         ::std::array<unsigned char, 16> mButtons {};
+         ::std::array<float, 8> mAxes {0, 0, 0, 0, -1, -1, 0, 0};
+      };
+
+      static_assert(GLFW_GAMEPAD_BUTTON_LAST < 16
+                and GLFW_GAMEPAD_AXIS_LAST < 8,
+         "Gamepad state doesn't fit");
+      static_assert(GLFW_GAMEPAD_AXIS_LEFT_TRIGGER == 4
+                and GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER == 5,
+         "Gamepad rest state doesn't match the trigger axes");
+
+   private:
+      // State of each gamepad, as of the last poll                     
+      ::std::array<State, Max> mStates {};
+      // Bit N is set if joystick N is a connected gamepad              
+      ::std::uint32_t mConnected = 0;
+      // Bit N is set if gamepad N was successfully polled last time    
+      ::std::uint32_t mPolled = 0;
+
+   public:
+      void Scan();
+      void Poll(TMany<Many>&, EventPool&);
+
+      NOD() bool IsConnected(int) const noexcept;
+      NOD() bool IsAnyConnected() const noexcept;
+      NOD() const State& GetState(int) const noexcept;
+   };
+
+} // namespace GLFW
@@ -0,0 +1,289 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Common.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <initializer_list>
+
+
+namespace GLFW
+{
+
+   using SteadyTime = ::std::chrono::steady_clock::time_point;
+
+
+   ///                                                                        
+   ///   Raw input event                                                      
+   ///                                                                        
+   /// A compact, trivially copyable snapshot of a single GLFW callback,      
+   /// timestamped at callback entry. Raw events are captured on the thread   
+   /// that polls GLFW, and translated to Langulus events on the thread that  
+   /// updates the window                                                     
+   ///                                                                        
+   struct RawEvent {
+      enum Type : ::std::uint8_t {
+         Closed, Key, Move, Resize, Focus, Minimize, Resolution,
+         Hover, MouseKey, MouseMove, Scroll, Char, Drop,
+         TypeCount
+      };
+
+      // The callback that produced the event                           
+      Type mType {};
+      // When the event was received from the OS                        
+      SteadyTime mTime;
+      // Callback arguments                                             
+      union {
+         int mInt[4];
+         double mReal[2];
+      };
+
+      RawEvent() noexcept
+         : mInt {} {}
+
+      RawEvent(Type type, int a = 0, int b = 0, int c = 0, int d = 0) noexcept
+         : mType {type}
+         , mTime {::std::chrono::steady_clock::now()}
+         , mInt {a, b, c, d} {}
+
+      RawEvent(Type type, double x, double y) noexcept
+         : mType {type}
+         , mTime {::std::chrono::steady_clock::now()}
+         , mReal {x, y} {}
+   };
+
+
+   /// Encode a single codepoint as UTF-8                                     
+   /// Invalid codepoints and surrogates are not encoded                      
+   ///   @param codepoint - the UTF-32 codepoint                              
+   ///   @param utf8 - [out] the encoded bytes                                
+   ///   @return the number of encoded bytes, or zero if codepoint is invalid 
+   LANGULUS(INLINED)
+   Count EncodeUTF8(char32_t codepoint, char (&utf8)[4]) noexcept {
+      if (codepoint < 0x80) {
+         utf8[0] = static_cast<char>(codepoint);
+         return 1;
+      }
+      else if (codepoint < 0x800) {
+         utf8[0] = static_cast<char>(0xC0 | (codepoint >> 6));
+         utf8[1] = static_cast<char>(0x80 | (codepoint & 0x3F));
+         return 2;
+      }
+      else if (codepoint < 0x10000) {
+         if (codepoint >= 0xD800 and codepoint <= 0xDFFF)
+            return 0;
+         utf8[0] = static_cast<char>(0xE0 | (codepoint >> 12));
+         utf8[1] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+         utf8[2] = static_cast<char>(0x80 | (codepoint & 0x3F));
+         return 3;
+      }
+      else if (codepoint < 0x110000) {
+         utf8[0] = static_cast<char>(0xF0 | (codepoint >> 18));
+         utf8[1] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+         utf8[2] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+         utf8[3] = static_cast<char>(0x80 | (codepoint & 0x3F));
+         return 4;
+      }
+      return 0;
+   }
+
+
+   ///                                                                        
+   ///   Cursor history sample                                                
+   ///                                                                        
+   /// Every cursor position and scroll callback is recorded as a sample, so  
+   /// that the full sub-frame motion path is available, and not just the     
+   /// final position at update                                               
+   ///                                                                        
+   struct CursorSample {
+      enum Kind : ::std::uint8_t {
+         Position, Scroll
+      };
+
+      // Whether this is a cursor position, or a scroll offset          
+      Kind mKind {};
+      // When the sample was received from the OS                       
+      SteadyTime mTime;
+      // Position relative to the window, or scroll offset              
+      double mX {};
+      double mY {};
+   };
+
+
+   ///                                                                        
+   ///   Held keyboard keys and mouse buttons, with per-frame edges           
+   ///                                                                        
+   /// Bits are indexed by GLFW key code, and mouse buttons follow the last   
+   /// key code. Bindings are tested against masks, a whole word at a time    
+   ///                                                                        
+   struct ButtonState {
+      static constexpr int MouseOffset = GLFW_KEY_LAST + 1;
+      static constexpr Count Bits = MouseOffset + GLFW_MOUSE_BUTTON_LAST + 1;
+      static constexpr Count Words = (Bits + 63) / 64;
+      using Mask = ::std::array<::std::uint64_t, Words>;
+
+      // Keys and buttons currently held                                
+      Mask mHeld {};
+      // Keys and buttons pressed since the last update                 
+      Mask mPressed {};
+      // Keys and buttons released since the last update                
+      Mask mReleased {};
+
+      /// Make a mask out of keyboard key codes                               
+      ///   @param keys - GLFW key codes                                      
+      ///   @return the mask                                                  
+      static constexpr Mask Keys(::std::initializer_list<int> keys) noexcept {
+         Mask mask {};
+         for (auto key : keys)
+            mask[key / 64] |= ::std::uint64_t {1} << (key % 64);
+         return mask;
+      }
+
+      /// Make a mask out of mouse button codes                               
+      ///   @param buttons - GLFW mouse button codes                          
+      ///   @return the mask                                                  
+      static constexpr Mask Buttons(
+         ::std::initializer_list<int> buttons
+      ) noexcept {
+         Mask mask {};
+         for (auto button : buttons) {
+            const auto bit = MouseOffset + button;
+            mask[bit / 64] |= ::std::uint64_t {1} << (bit % 64);
+         }
+         return mask;
+      }
+
+      /// Set or clear a bit, and record the edge, if any                     
+      ///   @param bit - the bit index                                        
+      ///   @param held - whether key or button is held                       
+      constexpr void Set(int bit, bool held) noexcept {
+         if (bit < 0 or static_cast<Count>(bit) >= Bits)
+            return;
+
+         const auto word = bit / 64;
+         const auto flag = ::std::uint64_t {1} << (bit % 64);
+         if (held == bool(mHeld[word] & flag))
+            return;
+
+         if (held) {
+            mHeld[word] |= flag;
+            mPressed[word] |= flag;
+         }
+         else {
+            mHeld[word] &= ~flag;
+            mReleased[word] |= flag;
+         }
+      }
+
+      /// Start a new frame, forgetting the edges                             
+      constexpr void ClearEdges() noexcept {
+         mPressed = {};
+         mReleased = {};
+      }
+
+      /// Release everything, recording the edges                             
+      constexpr void ReleaseAll() noexcept {
+         for (Count i = 0; i < Words; ++i) {
+            mReleased[i] |= mHeld[i];
+            mHeld[i] = 0;
+         }
+      }
+
+      /// Check if all keys and buttons in a mask are in a set                
+      static constexpr bool All(const Mask& set, const Mask& mask) noexcept {
+         ::std::uint64_t missing = 0;
+         for (Count i = 0; i < Words; ++i)
+            missing |= mask[i] & ~set[i];
+         return not missing;
+      }
+
+      /// Check if any key or button in a mask is in a set                    
+      static constexpr bool Any(const Mask& set, const Mask& mask) noexcept {
+         ::std::uint64_t found = 0;
+         for (Count i = 0; i < Words; ++i)
+            found |= mask[i] & set[i];
+         return found != 0;
+      }
+
+      constexpr bool AllHeld(const Mask& mask) const noexcept {
+         return All(mHeld, mask);
+      }
+      constexpr bool AnyHeld(const Mask& mask) const noexcept {
+         return Any(mHeld, mask);
+      }
+      constexpr bool AnyPressed(const Mask& mask) const noexcept {
+         return Any(mPressed, mask);
+      }
+      constexpr bool AnyReleased(const Mask& mask) const noexcept {
+         return Any(mReleased, mask);
+      }
+   };
+
+
+   ///                                                                        
+   ///   Lock-free single-producer/single-consumer ring buffer                
+   ///                                                                        
+   /// The producer is the thread that polls GLFW, the consumer is the thread 
+   /// that updates the window. The ring has a fixed capacity, and pushing to 
+   /// a full ring fails instead of blocking the producer                     
+   ///                                                                        
+   template<class T, Count SIZE>
+   struct TInputRing {
+      static_assert(SIZE and (SIZE & (SIZE - 1)) == 0,
+         "Ring size must be a power of two");
+
+   private:
+      ::std::array<T, SIZE> mData;
+      // Next slot to write - modified only by the producer             
+      alignas(64) ::std::atomic<Count> mHead {0};
+      // Next slot to read - modified only by the consumer              
+      alignas(64) ::std::atomic<Count> mTail {0};
+
+   public:
+      /// Push an element - call only from the producer thread                
+      ///   @param item - the element to push                                 
+      ///   @return false if the ring is full and the element was dropped     
+      bool Push(const T& item) noexcept {
+         const auto head = mHead.load(::std::memory_order_relaxed);
+         if (head - mTail.load(::std::memory_order_acquire) == SIZE)
+            return false;
+
+         mData[head & (SIZE - 1)] = item;
+         mHead.store(head + 1, ::std::memory_order_release);
+         return true;
+      }
+
+      /// Pop an element - call only from the consumer thread                 
+      ///   @param item - [out] the popped element                            
+      ///   @return false if the ring is empty                                
+      bool Pop(T& item) noexcept {
+         const auto tail = mTail.load(::std::memory_order_relaxed);
+         if (tail == mHead.load(::std::memory_order_acquire))
+            return false;
+
+         item = mData[tail & (SIZE - 1)];
+         mTail.store(tail + 1, ::std::memory_order_release);
+         return true;
+      }
+
+      /// Get the number of elements that can be pushed - call only from the  
+      /// producer thread, where it can only grow meanwhile                   
+      Count GetSpace() const noexcept {
+         return SIZE - (mHead.load(::std::memory_order_relaxed)
+                      - mTail.load(::std::memory_order_acquire));
+      }
+
+      /// Check if ring is empty                                              
+      bool IsEmpty() const noexcept {
+         return mTail.load(::std::memory_order_relaxed)
+             == mHead.load(::std::memory_order_acquire);
+      }
+   };
+
+} // namespace GLFW
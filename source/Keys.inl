@@ -0,0 +1,231 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "EventPool.hpp"
+#include <Entity/Event.hpp>
+#include <array>
+
+
+/// Mapping between GLFW keyboard key codes and Langulus keys                 
+#define LANGULUS_GLFW_KEYS(X)                \
+   X(GLFW_KEY_SPACE,         Space)          \
+   X(GLFW_KEY_APOSTROPHE,    Apostrophe)     \
+   X(GLFW_KEY_COMMA,         Comma)          \
+   X(GLFW_KEY_MINUS,         Minus)          \
+   X(GLFW_KEY_PERIOD,        Period)         \
+   X(GLFW_KEY_SLASH,         Slash)          \
+   X(GLFW_KEY_BACKSLASH,     Hack)           \
+   X(GLFW_KEY_SEMICOLON,     Semicolon)      \
+   X(GLFW_KEY_LEFT_BRACKET,  LeftBracket)    \
+   X(GLFW_KEY_RIGHT_BRACKET, RightBracket)   \
+   X(GLFW_KEY_GRAVE_ACCENT,  Tilde)          \
+   X(GLFW_KEY_0,             Main0)          \
+   X(GLFW_KEY_1,             Main1)          \
+   X(GLFW_KEY_2,             Main2)          \
+   X(GLFW_KEY_3,             Main3)          \
+   X(GLFW_KEY_4,             Main4)          \
+   X(GLFW_KEY_5,             Main5)          \
+   X(GLFW_KEY_6,             Main6)          \
+   X(GLFW_KEY_7,             Main7)          \
+   X(GLFW_KEY_8,             Main8)          \
+   X(GLFW_KEY_9,             Main9)          \
+   X(GLFW_KEY_A,             A)              \
+   X(GLFW_KEY_B,             B)              \
+   X(GLFW_KEY_C,             C)              \
+   X(GLFW_KEY_D,             D)              \
+   X(GLFW_KEY_E,             E)              \
+   X(GLFW_KEY_F,             F)              \
+   X(GLFW_KEY_G,             G)              \
+   X(GLFW_KEY_H,             H)              \
+   X(GLFW_KEY_I,             I)              \
+   X(GLFW_KEY_J,             J)              \
+   X(GLFW_KEY_K,             K)              \
+   X(GLFW_KEY_L,             L)              \
+   X(GLFW_KEY_M,             M)              \
+   X(GLFW_KEY_N,             N)              \
+   X(GLFW_KEY_O,             O)              \
+   X(GLFW_KEY_P,             P)              \
+   X(GLFW_KEY_Q,             Q)              \
+   X(GLFW_KEY_R,             R)              \
+   X(GLFW_KEY_S,             S)              \
+   X(GLFW_KEY_T,             T)              \
+   X(GLFW_KEY_U,             U)              \
+   X(GLFW_KEY_V,             V)              \
+   X(GLFW_KEY_W,             W)              \
+   X(GLFW_KEY_X,             X)              \
+   X(GLFW_KEY_Y,             Y)              \
+   X(GLFW_KEY_Z,             Z)              \
+   X(GLFW_KEY_ESCAPE,        Escape)         \
+   X(GLFW_KEY_ENTER,         Enter)          \
+   X(GLFW_KEY_TAB,           Tab)            \
+   X(GLFW_KEY_BACKSPACE,     Back)           \
+   X(GLFW_KEY_INSERT,        Insert)         \
+   X(GLFW_KEY_DELETE,        Delete)         \
+   X(GLFW_KEY_PAGE_UP,       PageUp)         \
+   X(GLFW_KEY_PAGE_DOWN,     PageDown)       \
+   X(GLFW_KEY_HOME,          Home)           \
+   X(GLFW_KEY_END,           End)            \
+   X(GLFW_KEY_LEFT,          Left)           \
+   X(GLFW_KEY_RIGHT,         Right)          \
+   X(GLFW_KEY_UP,            Up)             \
+   X(GLFW_KEY_DOWN,          Down)           \
+   X(GLFW_KEY_CAPS_LOCK,     CapsLock)       \
+   X(GLFW_KEY_SCROLL_LOCK,   ScrollLock)     \
+   X(GLFW_KEY_NUM_LOCK,      NumLock)        \
+   X(GLFW_KEY_PRINT_SCREEN,  Print)          \
+   X(GLFW_KEY_PAUSE,         Pause)          \
+   X(GLFW_KEY_F1,            F1)             \
+   X(GLFW_KEY_F2,            F2)             \
+   X(GLFW_KEY_F3,            F3)             \
+   X(GLFW_KEY_F4,            F4)             \
+   X(GLFW_KEY_F5,            F5)             \
+   X(GLFW_KEY_F6,            F6)             \
+   X(GLFW_KEY_F7,            F7)             \
+   X(GLFW_KEY_F8,            F8)             \
+   X(GLFW_KEY_F9,            F9)             \
+   X(GLFW_KEY_F10,           F10)            \
+   X(GLFW_KEY_F11,           F11)            \
+   X(GLFW_KEY_F12,           F12)            \
+   X(GLFW_KEY_F13,           F13)            \
+   X(GLFW_KEY_F14,           F14)            \
+   X(GLFW_KEY_F15,           F15)            \
+   X(GLFW_KEY_F16,           F16)            \
+   X(GLFW_KEY_F17,           F17)            \
+   X(GLFW_KEY_F18,           F18)            \
+   X(GLFW_KEY_F19,           F19)            \
+   X(GLFW_KEY_F20,           F20)            \
+   X(GLFW_KEY_F21,           F21)            \
+   X(GLFW_KEY_F22,           F22)            \
+   X(GLFW_KEY_F23,           F23)            \
+   X(GLFW_KEY_F24,           F24)            \
+   X(GLFW_KEY_KP_0,          Numpad0)        \
+   X(GLFW_KEY_KP_1,          Numpad1)        \
+   X(GLFW_KEY_KP_2,          Numpad2)        \
+   X(GLFW_KEY_KP_3,          Numpad3)        \
+   X(GLFW_KEY_KP_4,          Numpad4)        \
+   X(GLFW_KEY_KP_5,          Numpad5)        \
+   X(GLFW_KEY_KP_6,          Numpad6)        \
+   X(GLFW_KEY_KP_7,          Numpad7)        \
+   X(GLFW_KEY_KP_8,          Numpad8)        \
+   X(GLFW_KEY_KP_9,          Numpad9)        \
+   X(GLFW_KEY_KP_EQUAL,      NumpadEqual)    \
+   X(GLFW_KEY_KP_DECIMAL,    NumpadDecimal)  \
+   X(GLFW_KEY_KP_DIVIDE,     NumpadDivide)   \
+   X(GLFW_KEY_KP_MULTIPLY,   NumpadMultiply) \
+   X(GLFW_KEY_KP_SUBTRACT,   NumpadSubtract) \
+   X(GLFW_KEY_KP_ADD,        NumpadAdd)      \
+   X(GLFW_KEY_KP_ENTER,      NumpadEnter)    \
+   X(GLFW_KEY_LEFT_SHIFT,    LeftShift)      \
+   X(GLFW_KEY_RIGHT_SHIFT,   RightShift)     \
+   X(GLFW_KEY_LEFT_CONTROL,  LeftControl)    \
+   X(GLFW_KEY_RIGHT_CONTROL, RightControl)   \
+   X(GLFW_KEY_LEFT_ALT,      LeftAlt)        \
+   X(GLFW_KEY_RIGHT_ALT,     RightAlt)
+
+/// Mapping between GLFW mouse button codes and Langulus keys                 
+#define LANGULUS_GLFW_MOUSE_KEYS(X)         \
+   X(GLFW_MOUSE_BUTTON_LEFT,   LeftMouse)   \
+   X(GLFW_MOUSE_BUTTON_RIGHT,  RightMouse)  \
+   X(GLFW_MOUSE_BUTTON_MIDDLE, MiddleMouse) \
+   X(GLFW_MOUSE_BUTTON_4,      Mouse4)      \
+   X(GLFW_MOUSE_BUTTON_5,      Mouse5)      \
+   X(GLFW_MOUSE_BUTTON_6,      Mouse6)      \
+   X(GLFW_MOUSE_BUTTON_7,      Mouse7)      \
+   X(GLFW_MOUSE_BUTTON_8,      Mouse8)
+
+
+namespace GLFW::Inner
+{
+
+   ///                                                                        
+   /// Translates an input code to an event, and pushes it to an event list   
+   ///                                                                        
+   using Translator = void(*)(TMany<Many>&, EventState, EventPool*);
+
+   ///                                                                        
+   /// A translation table entry - the type of the produced event, so that    
+   /// it can be filtered before translating, and the translator itself       
+   ///                                                                        
+   struct Translation {
+      DMeta(*mType)() = nullptr;
+      Translator mTranslator = nullptr;
+   };
+
+   /// Get the type of an event                                               
+   ///   @tparam E - the event                                                
+   ///   @return the event type                                               
+   template<class E>
+   DMeta TypeOf() {
+      return MetaDataOf<E>();
+   }
+
+   /// Push a prototype of an event to an event list                          
+   ///   @tparam E - the event to push                                        
+   ///   @param events - [out] the event list                                 
+   ///   @param state - the event state                                       
+   ///   @param pool - the pool to reuse event containers from, if any        
+   template<class E>
+   void Translate(TMany<Many>& events, EventState state, EventPool* pool) {
+      if (pool)
+         pool->Push(events, E {state});
+      else
+         events << Many {E {state}};
+   }
+
+   #define LANGULUS_GLFW_TRANSLATOR(code, key) \
+      table[code] = {&TypeOf<Keys::key>, &Translate<Keys::key>};
+
+   /// Compile-time translation table, indexed by GLFW keyboard key code      
+   /// Unmapped key codes have a null translator                              
+   constexpr auto KeyboardTable = [] {
+      ::std::array<Translation, GLFW_KEY_LAST + 1> table {};
+      LANGULUS_GLFW_KEYS(LANGULUS_GLFW_TRANSLATOR)
+      return table;
+   }();
+
+   /// Compile-time translation table, indexed by GLFW mouse button code      
+   /// Unmapped button codes have a null translator                           
+   constexpr auto MouseTable = [] {
+      ::std::array<Translation, GLFW_MOUSE_BUTTON_LAST + 1> table {};
+      LANGULUS_GLFW_MOUSE_KEYS(LANGULUS_GLFW_TRANSLATOR)
+      return table;
+   }();
+
+   #undef LANGULUS_GLFW_TRANSLATOR
+
+   /// Accepts events of any type                                             
+   struct AcceptAll {
+      constexpr bool operator() (DMeta) const noexcept { return true; }
+   };
+
+   /// Translate a GLFW code via a translation table, with a single load      
+   ///   @param table - the table to use for translation                      
+   ///   @param code - the GLFW code to translate                             
+   ///   @param events - [out] the event list to push the event to            
+   ///   @param state - the event state                                       
+   ///   @param pool - the pool to reuse event containers from, if any        
+   ///   @param accept - checks the event type, before translating            
+   ///   @return true if code was translated and an event was pushed          
+   template<Count N, class F = AcceptAll> LANGULUS(INLINED)
+   bool TranslateCode(
+      const ::std::array<Translation, N>& table, int code,
+      TMany<Many>& events, EventState state, EventPool* pool = nullptr,
+      F&& accept = {}
+   ) {
+      if (code < 0 or static_cast<Count>(code) >= N)
+         return false;
+
+      const auto& translation = table[code];
+      if (not translation.mTranslator or not accept(translation.mType()))
+         return false;
+
+      translation.mTranslator(events, state, pool);
+      return true;
+   }
+
+} // namespace GLFW::Inner
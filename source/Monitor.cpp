@@ -12,15 +12,82 @@
 namespace GLFW
 {
 
+   /// Pick the video mode that best fits a size and refresh rate             
+   /// An exact size is preferred, with the requested or the highest refresh  
+   /// rate, otherwise the mode with the closest area is picked               
+   ///   @param w - preferred width, in screen units                          
+   ///   @param h - preferred height, in screen units                         
+   ///   @param rate - preferred refresh rate, or zero for the highest        
+   ///   @return the picked mode, or nullptr if monitor has no modes          
+   const GLFWvidmode* MonitorInfo::PickMode(
+      int w, int h, int rate
+   ) const noexcept {
+      const GLFWvidmode* best = nullptr;
+      long long bestDistance = 0;
+      for (auto& mode : mModes) {
+         long long distance = ::std::abs(
+            static_cast<long long>(mode.width) * mode.height
+          - static_cast<long long>(w) * h);
+         if (mode.width == w and mode.height == h) {
+            if (rate)
+               distance = -1 - (mode.refreshRate == rate);
+            else
+               distance = -1;
+         }
+
+         // Modes are sorted by refresh rate, so on equal distance the  
+         // later mode has the higher rate                              
+         if (not best or distance <= bestDistance) {
+            best = &mode;
+            bestDistance = distance;
+         }
+      }
+
+      return best;
+   }
+
    /// Monitor construction                                                   
+   /// A monitor can be picked by name, otherwise the primary one is used     
    ///   @param producer - monitor owner                                      
    ///   @param descriptor - monitor descriptor                               
    Monitor::Monitor(GLFW::Platform* producer, Describe descriptor)
       : Resolvable   {this}
       , ProducedFrom {producer, descriptor} {
       VERBOSE_GLFW("Initializing...");
+      SeekValueAux(descriptor, mName);
+
+      for (auto& info : producer->GetMonitors()) {
+         if (mName->IsEmpty() ? info.mPrimary : *mName == info.mName) {
+            mGLFWMonitor = info.mHandle;
+            mName = info.mName;
+            break;
+         }
+      }
+
+      LANGULUS_ASSERT(mGLFWMonitor, Construct, "No such monitor");
       Couple(descriptor);
       VERBOSE_GLFW("Initialized...");
    }
 
+   /// Nothing to refresh from the hierarchy - the monitor properties are     
+   /// refreshed by the platform on hotplug                                   
+   void Monitor::Refresh() {}
+
+   /// Get the GLFW monitor handle                                            
+   ///   @return the handle, or nullptr if monitor got disconnected           
+   GLFWmonitor* Monitor::GetHandle() const noexcept {
+      return GetInfo() ? mGLFWMonitor.Get() : nullptr;
+   }
+
+   /// Get the cached monitor properties                                      
+   ///   @return the properties, or nullptr if monitor got disconnected       
+   const MonitorInfo* Monitor::GetInfo() const noexcept {
+      for (auto& info : GetProducer()->GetMonitors()) {
+         if (info.mHandle == mGLFWMonitor)
+            return &info;
+      }
+
+      return nullptr;
+   }
+
 } // namespace GLFW
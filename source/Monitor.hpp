@@ -8,23 +8,63 @@
 #pragma once
 #include "Common.hpp"
 #include <Flow/Factory.hpp>
+#include <vector>
 
 
 namespace GLFW
 {
 
+   ///                                                                        
+   ///   Cached monitor properties                                            
+   ///                                                                        
+   /// Gathered once for every connected monitor, and again only when a       
+   /// monitor is connected or disconnected, so that using a monitor never    
+   /// makes a round-trip to the display server                               
+   ///                                                                        
+   struct MonitorInfo {
+      GLFWmonitor* mHandle {};
+      Text mName;
+      bool mPrimary = false;
+      // Position of the monitor on the virtual screen, in screen units 
+      int mPosition[2] {};
+      // Area not occupied by task bars and menu bars, in screen units  
+      int mWorkArea[4] {};
+      // Ratio between pixels and screen units                          
+      float mContentScale[2] {1, 1};
+      // Video mode at the time of caching                              
+      GLFWvidmode mCurrentMode {};
+      // All supported video modes, sorted by size and refresh rate     
+      ::std::vector<GLFWvidmode> mModes;
+
+      NOD() const GLFWvidmode* PickMode(int, int, int = 0) const noexcept;
+   };
+
+
    ///                                                                        
    ///   GLFW monitor                                                         
    ///                                                                        
+   /// Refers to a connected monitor by its GLFW handle. All properties are   
+   /// read from the platform's monitor cache, and the monitor is considered  
+   /// disconnected when its handle is no longer in it                        
+   ///                                                                        
    struct Monitor final : A::Platform, ProducedFrom<GLFW::Platform> {
       LANGULUS(ABSTRACT) false;
       LANGULUS(PRODUCER) GLFW::Platform;
       LANGULUS_BASES(A::Platform);
 
+   private:
+      // The monitor handle (GLFW specific)                             
+      Own<GLFWmonitor*> mGLFWMonitor;
+      // Monitor name, used to pick a monitor from the descriptor       
+      Traits::Name::Tag<Text> mName;
+
    public:
       Monitor(GLFW::Platform*, Describe);
 
-      void Refresh() final {}
+      void Refresh() final;
+
+      NOD() GLFWmonitor* GetHandle() const noexcept;
+      NOD() const MonitorInfo* GetInfo() const noexcept;
    };
 
-} // namespace GLFW
\ No newline at end of file
+} // namespace GLFW
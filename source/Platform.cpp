@@ -6,11 +6,17 @@
 /// SPDX-License-Identifier: GPL-3.0-or-later                                 
 ///                                                                           
 #include "Platform.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
 
 LANGULUS_DEFINE_MODULE(
    GLFW::Platform, 9, "GLFW",
    "Native window/dialog module, using GLFW as backend", "",
-   GLFW::Platform, GLFW::Window, GLFW::Cursor, GLFW::Monitor
+   GLFW::Platform, GLFW::Window, GLFW::Cursor, GLFW::Monitor,
+   GLFW::DroppedFile, GLFW::WindowFileInfo,
+   GLFW::GamepadButton, GLFW::GamepadAxis, GLFW::GamepadConnection,
+   GLFW::EventTiming
 )
 
 
@@ -24,56 +30,511 @@ namespace GLFW
       Logger::Error("GLFW Error code ", error, ": ", description);
    }
 
+   /// Set when a monitor is connected or disconnected, possibly on the       
+   /// polling thread. GLFW monitor callbacks carry no user pointer, so the   
+   /// flag is shared by all instances of the module                          
+   ::std::atomic<bool> MonitorsChanged = false;
+
+   /// Monitor hotplug relay                                                  
+   void OnMonitor(GLFWmonitor*, int) {
+      MonitorsChanged = true;
+   }
+
+   /// Set when a joystick is connected or disconnected, possibly on the      
+   /// polling thread                                                         
+   ::std::atomic<bool> GamepadsChanged = false;
+
+   /// Joystick hotplug relay                                                 
+   void OnJoystick(int, int) {
+      GamepadsChanged = true;
+   }
+
+   /// Check if a creation verb requests any GLFW-backed component            
+   ///   @param verb - the creation verb                                      
+   ///   @return true if a window, monitor, or cursor might be produced       
+   bool RequestsComponents(const Verb& verb) {
+      const auto produces = [](DMeta type) {
+         return type and (MetaDataOf<GLFW::Window>()->CastsTo(type)
+                       or MetaDataOf<GLFW::Monitor>()->CastsTo(type)
+                       or MetaDataOf<GLFW::Cursor>()->CastsTo(type));
+      };
+
+      bool requested = false;
+      verb.ForEachDeep(
+         [&](const Construct& construct) {
+            requested |= produces(construct.GetType());
+         },
+         [&](const DMeta& type) {
+            requested |= produces(type);
+         }
+      );
+      return requested;
+   }
+
    /// Module construction                                                    
    ///   @param runtime - the runtime that owns the module                    
    ///   @param descriptor - instructions for configuring the module          
-   Platform::Platform(Runtime* runtime, Describe)
+   Platform::Platform(Runtime* runtime, Describe descriptor)
       : Resolvable {this}
       , Module     {runtime}
-      , mWindows   {this} {
+      , mWindows   {this}
+      , mMonitors  {this}
+      , mCursors   {this}
+      , mConstructed {::std::chrono::steady_clock::now()} {
       VERBOSE_GLFW("Initializing...");
 
-      // Bind our logger first                                          
+      // Check if OS events should be polled on a dedicated thread, and 
+      // whether or not we should wait for them on update               
+      descriptor->ForEachDeep([&](const Trait& trait) {
+         if (trait.IsTrait<Traits::ThreadedInput>())
+            mThreadedInput = trait.AsCast<bool>();
+         else if (trait.IsTrait<Traits::Headless>())
+            mHeadless = trait.AsCast<bool>();
+         else if (trait.IsTrait<Traits::WaitEvents>()) {
+            if (trait.Is<Time>()) {
+               mWaitPolicy = WaitPolicy::WaitTimeout;
+               mWaitTimeout = ::std::chrono::duration<double>(
+                  trait.AsCast<Time>()).count();
+            }
+            else if (trait.AsCast<bool>())
+               mWaitPolicy = WaitPolicy::Wait;
+         }
+      });
+
+      // Headless mode can also be forced via the environment, so that  
+      // CI machines without a display can run the module as it is      
+      if (const auto env = ::std::getenv("LANGULUS_GLFW_HEADLESS"))
+         mHeadless = *env and *env != '0';
+
+      // Bind our logger first. GLFW itself is initialized when the     
+      // first component is created, so that processes that only load   
+      // the module don't connect to the display                        
       glfwSetErrorCallback(ErrorRelay);
 
-      // Initialize GLFW                                                
+      mStats.mStartup.mLoad = ::std::chrono::steady_clock::now() - mConstructed;
+      VERBOSE_GLFW("Initialized");
+   }
+
+   /// Initialize GLFW, gather the monitors and gamepads, and start polling   
+   /// Done on first use, because initializing GLFW connects to the display   
+   void Platform::Initialize() {
+      if (mInitialized)
+         return;
+
+      const auto start = ::std::chrono::steady_clock::now();
+      if (mHeadless)
+         glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
       if (not glfwInit())
          LANGULUS_THROW(Construct, "Error initializing GLFW");
+      mInitialized = true;
 
-      VERBOSE_GLFW("Initialized");
+      // Gather monitors once, and again only on hotplug                
+      glfwSetMonitorCallback(OnMonitor);
+      RefreshMonitors();
+
+      // Find connected gamepads once, and again only on hotplug        
+      glfwSetJoystickCallback(OnJoystick);
+      mGamepads.Scan();
+
+      if (mThreadedInput) {
+         // GLFW requires events to be polled on the main thread. X11   
+         // tolerates another thread, as long as all backend calls are  
+         // serialized, but Win32 delivers messages only to the thread  
+         // that created the window, and Cocoa and Wayland expect the   
+         // main thread, too                                            
+         const auto backend = glfwGetPlatform();
+         if (backend == GLFW_PLATFORM_X11 or backend == GLFW_PLATFORM_NULL) {
+            mPolling = true;
+            mPoller = ::std::thread {&Platform::PollLoop, this};
+         }
+         else Logger::Warning(Self(), "Threaded input is supported only "
+            "on X11 - events will be polled on update");
+      }
+
+      mStats.mStartup.mInit = ::std::chrono::steady_clock::now() - start;
    }
 
    /// Module destruction                                                     
    Platform::~Platform() {
-      // Destroy windows first                                          
+      // Stop polling first                                             
+      if (mPoller.joinable()) {
+         mPolling = false;
+         mPoller.join();
+      }
+
+      // Destroy windows, and the monitors they might refer to          
       mWindows.Reset();
-      // Terminate GLFW                                                 
-      glfwTerminate();
+      mMonitors.Reset();
+      mCursors.Reset();
+      // Destroy pooled windows, and terminate GLFW, if it was ever used
+      for (auto window : mWindowPool)
+         glfwDestroyWindow(window);
+      mWindowPool.clear();
+
+      if (mInitialized)
+         glfwTerminate();
    }
 
    /// Module update routine                                                  
    ///   @param dt - time from last update                                    
    bool Platform::Update(Time) {
-      // Retrieve and dispatch OS events                                
-      glfwPollEvents();
+      // Nothing to do before the first component is created            
+      if (not mInitialized)
+         return false;
+
+      // Retrieve OS events, unless a dedicated thread is doing it.     
+      // Never wait if there are no windows, because there would be     
+      // nothing to wake us up                                          
+      using Clock = ::std::chrono::steady_clock;
+      auto start = Clock::now();
+      if (not mPoller.joinable()) {
+         if (mActiveWindows.empty() or mWaitPolicy == WaitPolicy::Poll)
+            glfwPollEvents();
+         else {
+            double timeout = mWaitPolicy == WaitPolicy::Wait
+               ? ::std::numeric_limits<double>::infinity()
+               : mWaitTimeout;
+
+            // Gamepads aren't reported via OS events, so don't wait    
+            // longer than their poll interval, while any is connected  
+            if (mGamepads.IsAnyConnected())
+               timeout = ::std::min(timeout, GamepadWaitTimeout);
 
-      // Update all opened windows                                      
-      auto openedWindows = 0;
-      for (auto& window : mWindows) {
-         if (window.IsClosed())
+            // Don't wait past the moment a debounced resize settles    
+            auto settle = ::std::chrono::nanoseconds::max();
+            for (auto window : mActiveWindows)
+               settle = ::std::min(settle, window->GetSettleTime());
+            if (settle != ::std::chrono::nanoseconds::max()) {
+               timeout = ::std::min(timeout,
+                  ::std::chrono::duration<double>(settle).count());
+            }
+
+            if (timeout == ::std::numeric_limits<double>::infinity())
+               glfwWaitEvents();
+            else if (timeout > 0)
+               glfwWaitEventsTimeout(timeout);
+            else
+               glfwPollEvents();
+         }
+
+         mStats.mPoll.Add(Clock::now() - start);
+         start = Clock::now();
+      }
+
+      if (MonitorsChanged.exchange(false)) {
+         const auto lock = LockBackend();
+         RefreshMonitors();
+      }
+
+      const auto gamepadTime = Clock::now();
+      {
+         // Poll gamepads - only changes produce events                 
+         const auto lock = LockBackend();
+         if (GamepadsChanged.exchange(false))
+            mGamepads.Scan();
+         mGamepads.Poll(mGamepadEvents, mGamepadEventPool);
+      }
+
+      // Update active windows, dispatching their batched events. A     
+      // window that got closed is updated one last time, to deliver    
+      // its close event, and is then removed from the active list.     
+      // Handlers might create or destroy windows while dispatching, so 
+      // a snapshot is iterated instead                                 
+      mUpdating = mActiveWindows;
+      for (Offset i = 0; i < mUpdating.size(); ++i) {
+         if (not mUpdating[i])
             continue;
 
-         window.Update();
-         ++openedWindows;
+         if (mGamepadEvents and mUpdating[i]->IsInteractable())
+            mUpdating[i]->PushEvents(mGamepadEvents, gamepadTime);
+         mUpdating[i]->Update();
+
+         // The window might have been destroyed by its own handlers    
+         if (mUpdating[i] and mUpdating[i]->IsClosed())
+            Deactivate(mUpdating[i]);
       }
+      mUpdating.clear();
 
-      return openedWindows > 0;
+      mGamepadEvents.Clear();
+      mStats.mUpdate.Add(Clock::now() - start);
+      return not mActiveWindows.empty();
    }
 
    /// Create/Destroy platform components, such as native windows             
    ///   @param verb - the creation/destruction verb                          
    void Platform::Create(Verb& verb) {
+      // Don't connect to the display for requests that produce nothing 
+      if (not RequestsComponents(verb))
+         return;
+
+      Initialize();
       mWindows.Create(verb);
+      mMonitors.Create(verb);
+      mCursors.Create(verb);
+   }
+
+   /// Take a hidden native window from the pool, and show it                 
+   /// Much faster than creating a new window, which is a round-trip to the   
+   /// display server, and requires setting all the callbacks                 
+   ///   @param w - the new window width                                      
+   ///   @param h - the new window height                                     
+   ///   @param title - the new window title, null-terminated                 
+   ///   @return the native window, or nullptr if pool is empty               
+   GLFWwindow* Platform::AcquireWindow(int w, int h, const Text& title) {
+      if (mWindowPool.empty())
+         return nullptr;
+
+      const auto window = mWindowPool.back();
+      mWindowPool.pop_back();
+
+      const auto lock = LockBackend();
+      glfwSetWindowTitle(window, title.GetRaw());
+      glfwSetWindowSize(window, w, h);
+
+      // Center the window on the primary monitor, instead of showing   
+      // it wherever its previous user left it                          
+      if (const auto monitor = glfwGetPrimaryMonitor()) {
+         int x, y, width, height;
+         glfwGetMonitorWorkarea(monitor, &x, &y, &width, &height);
+         glfwSetWindowPos(window, x + (width - w) / 2, y + (height - h) / 2);
+      }
+
+      glfwShowWindow(window);
+      return window;
+   }
+
+   /// Return a native window to the pool, hiding it and resetting any state  
+   /// that a window might have changed, or destroy it if pool is full        
+   ///   @param window - the native window                                    
+   void Platform::ReleaseWindow(GLFWwindow* window) {
+      const auto lock = LockBackend();
+      if (mWindowPool.size() == WindowPoolLimit) {
+         glfwDestroyWindow(window);
+         return;
+      }
+
+      // Events received while pooled are ignored by the callbacks      
+      glfwSetWindowUserPointer(window, nullptr);
+      glfwHideWindow(window);
+      if (glfwGetWindowMonitor(window)) {
+         glfwSetWindowMonitor(window, nullptr, 0, 0,
+            640, 480, GLFW_DONT_CARE);
+      }
+
+      // A reused window must look like a new one, so undo anything     
+      // that might have been changed by the user, or by other modules  
+      glfwRestoreWindow(window);
+      glfwSetWindowSizeLimits(window, GLFW_DONT_CARE, GLFW_DONT_CARE,
+         GLFW_DONT_CARE, GLFW_DONT_CARE);
+      glfwSetWindowAspectRatio(window, GLFW_DONT_CARE, GLFW_DONT_CARE);
+      glfwSetWindowOpacity(window, 1.0f);
+      glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+      glfwSetCursor(window, nullptr);
+      mWindowPool.push_back(window);
+   }
+
+   /// Start updating a window each frame                                     
+   ///   @param window - the window to activate                               
+   void Platform::Activate(GLFW::Window* window) {
+      // Windows are visible when activated                             
+      if (mStats.mStartup.mFirstWindow == Nanoseconds {}) {
+         mStats.mStartup.mFirstWindow =
+            ::std::chrono::steady_clock::now() - mConstructed;
+      }
+
+      mActiveWindows.push_back(window);
+   }
+
+   /// Stop updating a window, if it is still active                          
+   ///   @param window - the window to deactivate                             
+   void Platform::Deactivate(GLFW::Window* window) noexcept {
+      // Make sure a window destroyed during an update isn't touched    
+      ::std::replace(mUpdating.begin(), mUpdating.end(),
+         window, static_cast<GLFW::Window*>(nullptr));
+
+      const auto found = ::std::find(
+         mActiveWindows.begin(), mActiveWindows.end(), window);
+      if (found == mActiveWindows.end())
+         return;
+
+      *found = mActiveWindows.back();
+      mActiveWindows.pop_back();
+   }
+
+   /// Any interaction with the module wakes it up, if it is waiting for OS   
+   /// events on update. The verb isn't handled here, so it isn't marked done 
+   void Platform::Interact(Verb&) {
+      Wake();
+   }
+
+   /// Wake up the module, if it is waiting for OS events on update           
+   /// Safe to call from any thread                                           
+   void Platform::Wake() {
+      if (mInitialized)
+         glfwPostEmptyEvent();
+   }
+
+   /// Check if module runs without a display, using a null backend           
+   ///   @return true if module is headless                                   
+   bool Platform::IsHeadless() const noexcept {
+      return mHeadless;
+   }
+
+   /// Check if OS events are polled on a dedicated thread                    
+   ///   @return true if a poller thread is running                           
+   bool Platform::IsInputThreaded() const noexcept {
+      return mPoller.joinable();
+   }
+
+   /// Log the module statistics, along with the statistics of all windows    
+   void Platform::DumpStats() const {
+      const auto tab = Logger::InfoTab(Self(), "Statistics:");
+      Logger::Info("Module load: ", mStats.mStartup.mLoad.count(), "ns");
+      Logger::Info("GLFW initialization: ",
+         mStats.mStartup.mInit.count(), "ns");
+      Logger::Info("First window visible after: ",
+         mStats.mStartup.mFirstWindow.count(), "ns");
+      Logger::Info("Polls: ", mStats.mPoll.mSamples, ", ",
+         mStats.mPoll.GetAverage().count(), "ns on average");
+      Logger::Info("Window updates: ", mStats.mUpdate.mSamples, ", ",
+         mStats.mUpdate.GetAverage().count(), "ns on average");
+
+      for (auto& window : mWindows)
+         window.DumpStats();
+   }
+
+   /// Poll OS events on a dedicated thread, capturing raw input at OS rate,  
+   /// regardless of how long it takes to update the windows                  
+   /// GLFW isn't thread-safe, so all backend calls are serialized via        
+   /// LockBackend, and the lock is held only while polling. Started only on  
+   /// backends that allow polling outside the main thread - see Initialize   
+   void Platform::PollLoop() {
+      while (mPolling) {
+         {
+            const auto lock = LockBackend();
+            glfwPollEvents();
+         }
+
+         ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+      }
+   }
+
+   /// Gather the properties of all connected monitors                        
+   void Platform::RefreshMonitors() {
+      mMonitorCache.clear();
+
+      int count = 0;
+      const auto monitors = glfwGetMonitors(&count);
+      const auto primary = glfwGetPrimaryMonitor();
+      mMonitorCache.reserve(count);
+
+      for (int i = 0; i < count; ++i) {
+         auto& info = mMonitorCache.emplace_back();
+         info.mHandle = monitors[i];
+         info.mName = glfwGetMonitorName(monitors[i]);
+         info.mPrimary = monitors[i] == primary;
+         glfwGetMonitorPos(monitors[i],
+            &info.mPosition[0], &info.mPosition[1]);
+         glfwGetMonitorWorkarea(monitors[i],
+            &info.mWorkArea[0], &info.mWorkArea[1],
+            &info.mWorkArea[2], &info.mWorkArea[3]);
+         glfwGetMonitorContentScale(monitors[i],
+            &info.mContentScale[0], &info.mContentScale[1]);
+
+         if (const auto mode = glfwGetVideoMode(monitors[i]))
+            info.mCurrentMode = *mode;
+
+         int modeCount = 0;
+         const auto modes = glfwGetVideoModes(monitors[i], &modeCount);
+         if (modes)
+            info.mModes.assign(modes, modes + modeCount);
+      }
+
+      VERBOSE_GLFW("Monitors gathered: ", mMonitorCache.size());
+   }
+
+   /// Get a standard cursor, creating it on first use                        
+   /// Standard cursors are destroyed by glfwTerminate                        
+   ///   @param shape - the GLFW cursor shape, like GLFW_IBEAM_CURSOR         
+   ///   @return the native cursor, or nullptr if shape isn't supported       
+   GLFWcursor* Platform::GetStandardCursor(int shape) {
+      const auto index = static_cast<Offset>(shape - GLFW_ARROW_CURSOR);
+      if (index >= mStandardCursors.size())
+         return nullptr;
+
+      auto& cursor = mStandardCursors[index];
+      if (not cursor) {
+         const auto lock = LockBackend();
+         cursor = glfwCreateStandardCursor(shape);
+      }
+
+      return cursor;
+   }
+
+   /// Mark a custom cursor as used, if it is still where it was cached       
+   ///   @param slot - the cursor's place in the cache                        
+   ///   @return true if slot is still valid                                  
+   bool Platform::UseCustomCursor(const CachedCursorSlot& slot) noexcept {
+      if (not slot.mHandle or slot.mGeneration != mCursorGeneration)
+         return false;
+
+      mCustomCursors[slot.mIndex].mLastUse = ++mCursorUses;
+      return true;
+   }
+
+   /// Get a custom cursor, uploading its image only if it isn't cached       
+   /// When the cache is full, the least recently used cursor is destroyed.   
+   /// GLFW reverts any window that still uses it to the default cursor       
+   ///   @param image - the cursor image                                      
+   ///   @return the cursor's place in the cache                              
+   CachedCursorSlot Platform::GetCustomCursor(const CursorImage& image) {
+      ++mCursorUses;
+      for (Offset i = 0; i < mCustomCursors.size(); ++i) {
+         auto& cached = mCustomCursors[i];
+         if (cached.mHash == image.mHash) {
+            cached.mLastUse = mCursorUses;
+            return {cached.mHandle, i, mCursorGeneration};
+         }
+      }
+
+      const auto lock = LockBackend();
+      if (mCustomCursors.size() == CustomCursorLimit) {
+         const auto oldest = ::std::min_element(
+            mCustomCursors.begin(), mCustomCursors.end(),
+            [](const CachedCursor& a, const CachedCursor& b) {
+               return a.mLastUse < b.mLastUse;
+            }
+         );
+
+         for (auto& window : mWindows)
+            window.ForgetCursor(oldest->mHandle);
+         glfwDestroyCursor(oldest->mHandle);
+         *oldest = mCustomCursors.back();
+         mCustomCursors.pop_back();
+         ++mCursorGeneration;
+      }
+
+      GLFWimage glfwImage;
+      glfwImage.width = image.mSize[0];
+      glfwImage.height = image.mSize[1];
+      glfwImage.pixels = const_cast<unsigned char*>(image.mPixels.data());
+      const auto handle = glfwCreateCursor(
+         &glfwImage, image.mHotspot[0], image.mHotspot[1]);
+      if (not handle)
+         return {};
+
+      mCustomCursors.push_back({image.mHash, handle, mCursorUses});
+      return {handle, mCustomCursors.size() - 1, mCursorGeneration};
+   }
+
+   /// Lock the GLFW backend for exclusive use by the calling thread          
+   /// If input isn't threaded, all GLFW calls are made from a single thread, 
+   /// and the returned lock is empty                                         
+   ///   @return the lock, released when it goes out of scope                 
+   ::std::unique_lock<::std::recursive_mutex> Platform::LockBackend() {
+      if (not mPoller.joinable())
+         return {};
+      return ::std::unique_lock {mBackendMutex};
    }
 
 } // namespace GLFW
\ No newline at end of file
@@ -7,7 +7,12 @@
 ///                                                                           
 #pragma once
 #include "Window.hpp"
+#include "Gamepad.hpp"
 #include <Flow/Verbs/Create.hpp>
+#include <Flow/Verbs/Interact.hpp>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 
 namespace GLFW
@@ -22,11 +27,91 @@ namespace GLFW
    struct Platform final : A::PlatformModule {
       LANGULUS(ABSTRACT) false;
       LANGULUS_BASES(A::PlatformModule);
-      LANGULUS_VERBS(Verbs::Create);
+      LANGULUS_VERBS(Verbs::Create, Verbs::Interact);
+
+      ///                                                                     
+      /// How OS events are retrieved on update                               
+      ///                                                                     
+      enum class WaitPolicy {
+         // Retrieve pending events, and return immediately             
+         Poll,
+         // Sleep until at least one event is available                 
+         Wait,
+         // Sleep until at least one event is available, or a timeout   
+         WaitTimeout
+      };
 
    private:
+      // Hidden native windows, ready to be reused by new windows       
+      static constexpr Count WindowPoolLimit = 4;
+      ::std::vector<GLFWwindow*> mWindowPool;
+      // Windows that are neither closed nor destroyed, in no particular
+      // order. Only these are polled and updated each frame            
+      ::std::vector<GLFW::Window*> mActiveWindows;
+      // Snapshot of the active windows, being updated right now. Window
+      // handlers might destroy windows, so destroyed ones are nulled   
+      ::std::vector<GLFW::Window*> mUpdating;
       // List of created windows                                        
       TFactory<GLFW::Window> mWindows;
+      // List of created monitors                                       
+      TFactory<GLFW::Monitor> mMonitors;
+      // Properties of all connected monitors, gathered on hotplug      
+      ::std::vector<MonitorInfo> mMonitorCache;
+      // List of created cursors                                        
+      TFactory<GLFW::Cursor> mCursors;
+      // Standard cursors, created on first use and shared by windows   
+      ::std::array<GLFWcursor*, Cursor::StandardCount> mStandardCursors {};
+
+      // Custom cursors keyed by the hash of their image, the least     
+      // recently used are destroyed first                              
+      struct CachedCursor {
+         Hash mHash;
+         GLFWcursor* mHandle;
+         Count mLastUse;
+      };
+
+      static constexpr Count CustomCursorLimit = 32;
+      ::std::vector<CachedCursor> mCustomCursors;
+      Count mCursorUses = 0;
+      // Incremented on each eviction, invalidating all cached slots    
+      Count mCursorGeneration = 1;
+
+      // Whether GLFW was initialized - done on first use. Atomic,      
+      // because Wake reads it from any thread                          
+      ::std::atomic<bool> mInitialized = false;
+      // When module construction started, for startup timing           
+      SteadyTime mConstructed;
+      // Whether a null backend is used, for display-less environments  
+      bool mHeadless = false;
+      // How events are retrieved on update                             
+      WaitPolicy mWaitPolicy = WaitPolicy::Poll;
+      // Timeout for WaitPolicy::WaitTimeout, in seconds                
+      double mWaitTimeout = 0;
+      // Gamepads don't produce OS events, so while any is connected,   
+      // waiting is limited to this long, in seconds                    
+      static constexpr double GamepadWaitTimeout = 1.0 / 120;
+
+      // Dedicated thread for polling OS events, if threaded input is   
+      // enabled via Traits::ThreadedInput in the module descriptor     
+      bool mThreadedInput = false;
+      ::std::thread mPoller;
+      ::std::atomic<bool> mPolling = false;
+      // Serializes GLFW access between the poller and other threads,   
+      // used only if threaded input is enabled                         
+      ::std::recursive_mutex mBackendMutex;
+
+      // State of all gamepads, polled on update                        
+      Gamepads mGamepads;
+      // Gamepad events produced on update, reused between updates      
+      TMany<Many> mGamepadEvents;
+      EventPool mGamepadEventPool;
+
+      // Poll and update timings, for profiling purposes                
+      PlatformStats mStats;
+
+      void Initialize();
+      void PollLoop();
+      void RefreshMonitors();
 
    public:
       Platform(Runtime*, Describe);
@@ -34,6 +119,32 @@ namespace GLFW
 
       bool Update(Time);
       void Create(Verb&);
+      void Interact(Verb&);
+
+      void Wake();
+      NOD() GLFWwindow* AcquireWindow(int, int, const Text&);
+      void ReleaseWindow(GLFWwindow*);
+      void Activate(GLFW::Window*);
+      void Deactivate(GLFW::Window*) noexcept;
+
+      NOD() bool IsHeadless() const noexcept;
+      NOD() bool IsInputThreaded() const noexcept;
+      NOD() const Gamepads& GetGamepads() const noexcept {
+         return mGamepads;
+      }
+      NOD() const ::std::vector<MonitorInfo>& GetMonitors() const noexcept {
+         return mMonitorCache;
+      }
+      NOD() const PlatformStats& GetStats() const noexcept {
+         return mStats;
+      }
+      void DumpStats() const;
+
+      NOD() GLFWcursor* GetStandardCursor(int);
+      NOD() CachedCursorSlot GetCustomCursor(const CursorImage&);
+      bool UseCustomCursor(const CachedCursorSlot&) noexcept;
+
+      NOD() ::std::unique_lock<::std::recursive_mutex> LockBackend();
    };
 
 } // namespace GLFW
\ No newline at end of file
@@ -0,0 +1,188 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "Recording.hpp"
+#include "Window.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if LANGULUS_OS(WINDOWS)
+   #include <windows.h>
+#else
+   #include <fcntl.h>
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <unistd.h>
+#endif
+
+
+namespace GLFW
+{
+
+   /// Open a recording for writing, overwriting it if it exists              
+   ///   @param path - the file to record to                                  
+   InputRecorder::InputRecorder(const Text& path)
+      : mStart {::std::chrono::steady_clock::now()} {
+      const auto raw = Text {path}.Terminate();
+      mFile = ::std::fopen(raw.GetRaw(), "wb");
+      LANGULUS_ASSERT(mFile, Construct, "Can't open input recording file");
+      ::std::fwrite(Recording::Magic, sizeof(Recording::Magic), 1, mFile);
+   }
+
+   /// Close the recording                                                    
+   InputRecorder::~InputRecorder() {
+      if (mFile)
+         ::std::fclose(mFile);
+   }
+
+   /// Write a raw event to the recording                                     
+   ///   @param raw - the event to record                                     
+   ///   @param drop - the dropped files, if event is a file drop             
+   void InputRecorder::Write(const RawEvent& raw, const FileDrop* drop) {
+      Recording::Record record {};
+      record.mType = raw.mType;
+      using ::std::chrono::nanoseconds;
+      record.mTime = ::std::chrono::duration_cast<nanoseconds>(
+         raw.mTime - mStart).count();
+      ::std::memcpy(record.mInt, raw.mInt, sizeof(record.mInt));
+
+      // The drop arena is already in the recording's payload format    
+      if (drop)
+         record.mExtra = static_cast<::std::uint32_t>(drop->GetArena().size());
+
+      ::std::fwrite(&record, sizeof(record), 1, mFile);
+      if (drop and record.mExtra)
+         ::std::fwrite(drop->GetArena().data(), record.mExtra, 1, mFile);
+   }
+
+   /// Memory-map a recording for replaying                                   
+   ///   @param path - the recording to replay                                
+   ///   @param realtime - whether to replay with original timing, or as fast 
+   ///                     as possible                                        
+   InputReplay::InputReplay(const Text& path, bool realtime)
+      : mStart {::std::chrono::steady_clock::now()}
+      , mRealtime {realtime} {
+      const auto raw = Text {path}.Terminate();
+
+      #if LANGULUS_OS(WINDOWS)
+         mFileHandle = CreateFileA(raw.GetRaw(), GENERIC_READ,
+            FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+         LANGULUS_ASSERT(mFileHandle != INVALID_HANDLE_VALUE, Construct,
+            "Can't open input recording file");
+
+         LARGE_INTEGER size;
+         GetFileSizeEx(mFileHandle, &size);
+         mSize = static_cast<Count>(size.QuadPart);
+         mMapping = CreateFileMappingA(mFileHandle, nullptr,
+            PAGE_READONLY, 0, 0, nullptr);
+         LANGULUS_ASSERT(mMapping, Construct,
+            "Can't map input recording file");
+         mData = static_cast<const ::std::byte*>(
+            MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+      #else
+         const int file = ::open(raw.GetRaw(), O_RDONLY);
+         LANGULUS_ASSERT(file >= 0, Construct,
+            "Can't open input recording file");
+
+         struct stat info;
+         ::fstat(file, &info);
+         mSize = static_cast<Count>(info.st_size);
+         auto data = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, file, 0);
+         ::close(file);
+         if (data != MAP_FAILED)
+            mData = static_cast<const ::std::byte*>(data);
+      #endif
+
+      LANGULUS_ASSERT(mData, Construct, "Can't map input recording file");
+      constexpr auto magic = sizeof(Recording::Magic);
+      LANGULUS_ASSERT(mSize >= magic
+         and 0 == ::std::memcmp(mData, Recording::Magic, magic),
+         Construct, "Not an input recording file");
+      mCursor = magic;
+   }
+
+   /// Unmap the recording                                                    
+   InputReplay::~InputReplay() {
+      #if LANGULUS_OS(WINDOWS)
+         if (mData)
+            UnmapViewOfFile(mData);
+         if (mMapping)
+            CloseHandle(mMapping);
+         if (mFileHandle and mFileHandle != INVALID_HANDLE_VALUE)
+            CloseHandle(mFileHandle);
+      #else
+         if (mData)
+            ::munmap(const_cast<::std::byte*>(mData), mSize);
+      #endif
+   }
+
+   /// Feed all due events to a window, via the GLFW callback path            
+   /// In realtime mode, events are fed when their original time comes        
+   /// Otherwise, up to half the capacity of the input ring is fed at once    
+   /// Never feeds more than the ring can take - the rest is fed on the next  
+   /// update, so that no recorded event is ever dropped                      
+   /// Records of unknown type are skipped, as are malformed drops            
+   ///   @param window - the window to feed                                   
+   void InputReplay::Feed(Window& window) {
+      using ::std::chrono::nanoseconds;
+      const auto elapsed = ::std::chrono::duration_cast<nanoseconds>(
+         ::std::chrono::steady_clock::now() - mStart).count();
+
+      const auto space = window.GetInputSpace();
+      const auto limit = mRealtime ? space : ::std::min<Count>(space, 512);
+      Count fed = 0;
+      ::std::vector<const char*> paths;
+      while (mCursor + sizeof(Recording::Record) <= mSize and fed < limit) {
+         Recording::Record record;
+         ::std::memcpy(&record, mData + mCursor, sizeof(record));
+         if (mRealtime and record.mTime > elapsed)
+            break;
+
+         // Make sure the extra payload isn't truncated                 
+         const auto extra = mData + mCursor + sizeof(record);
+         if (mCursor + sizeof(record) + record.mExtra > mSize) {
+            mCursor = mSize;
+            break;
+         }
+
+         mCursor += sizeof(record) + record.mExtra;
+         if (record.mType >= RawEvent::TypeCount)
+            continue;
+
+         if (record.mType == RawEvent::Drop) {
+            // Paths are NUL-terminated, one after another, so the      
+            // payload must end with a NUL, or strlen would overrun it  
+            if (record.mExtra and extra[record.mExtra - 1] != ::std::byte {0})
+               continue;
+
+            paths.clear();
+            auto path = reinterpret_cast<const char*>(extra);
+            const auto end = path + record.mExtra;
+            while (path < end) {
+               paths.push_back(path);
+               path += ::std::strlen(path) + 1;
+            }
+
+            window.CaptureDrop(static_cast<int>(paths.size()), paths.data());
+            ++fed;
+            continue;
+         }
+
+         RawEvent raw {static_cast<RawEvent::Type>(record.mType)};
+         ::std::memcpy(raw.mInt, record.mInt, sizeof(raw.mInt));
+         window.Capture(raw);
+         ++fed;
+      }
+   }
+
+   /// Check if all events were fed                                           
+   ///   @return true if replay is done                                       
+   bool InputReplay::IsDone() const noexcept {
+      return mCursor + sizeof(Recording::Record) > mSize;
+   }
+
+} // namespace GLFW
@@ -0,0 +1,95 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Input.hpp"
+#include "FileDrop.hpp"
+#include <cstdio>
+#include <vector>
+
+
+namespace GLFW
+{
+
+   ///                                                                        
+   ///   Binary input recording format                                        
+   ///                                                                        
+   /// A recording starts with the magic bytes, followed by a sequence of     
+   /// fixed-size records, timed relative to the start of the recording.      
+   /// Each record may be followed by extra payload bytes - file drops carry  
+   /// their NUL-terminated paths there                                       
+   ///                                                                        
+   namespace Recording
+   {
+      constexpr char Magic[8] {'L', 'G', 'F', 'W', 'R', 'E', 'C', '1'};
+
+      struct Record {
+         // RawEvent::Type                                              
+         ::std::uint8_t mType;
+         ::std::uint8_t mPadding[3];
+         // Number of extra payload bytes that follow this record       
+         ::std::uint32_t mExtra;
+         // Nanoseconds since the recording started                     
+         ::std::int64_t mTime;
+         // RawEvent arguments                                          
+         union {
+            int mInt[4];
+            double mReal[2];
+         };
+      };
+
+      static_assert(sizeof(Record) == 32, "Record must be compact");
+   }
+
+
+   ///                                                                        
+   ///   Input recorder                                                       
+   ///                                                                        
+   /// Writes every processed raw event to a binary file                      
+   ///                                                                        
+   struct InputRecorder {
+   private:
+      ::std::FILE* mFile {};
+      SteadyTime mStart;
+
+   public:
+      InputRecorder(const Text&);
+      ~InputRecorder();
+
+      void Write(const RawEvent&, const FileDrop* = nullptr);
+   };
+
+
+   ///                                                                        
+   ///   Input replay                                                         
+   ///                                                                        
+   /// Memory-maps a recording, and feeds its events to a window, through     
+   /// the same path the GLFW callbacks use. Events are fed either with the   
+   /// original timing, or as fast as the window can consume them             
+   ///                                                                        
+   struct InputReplay {
+   private:
+      const ::std::byte* mData {};
+      Count mSize {};
+      Offset mCursor {};
+      SteadyTime mStart;
+      bool mRealtime = true;
+
+      #if LANGULUS_OS(WINDOWS)
+         void* mFileHandle {};
+         void* mMapping {};
+      #endif
+
+   public:
+      InputReplay(const Text&, bool realtime);
+      ~InputReplay();
+
+      void Feed(Window&);
+      NOD() bool IsDone() const noexcept;
+   };
+
+} // namespace GLFW
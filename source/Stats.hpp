@@ -0,0 +1,102 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Input.hpp"
+#include <bit>
+
+
+namespace GLFW
+{
+
+   using Nanoseconds = ::std::chrono::nanoseconds;
+
+
+   ///                                                                        
+   ///   Timing histogram                                                     
+   ///                                                                        
+   /// Bucket N counts the samples that took less than 2^N microseconds, but  
+   /// not less than 2^(N-1), so it stays cheap to fill at any rate           
+   ///                                                                        
+   struct Histogram {
+      static constexpr Count Buckets = 24;
+
+      // Samples per bucket                                             
+      ::std::array<Count, Buckets> mBuckets {};
+      // Number of samples                                              
+      Count mSamples = 0;
+      // Sum of all samples                                             
+      Nanoseconds mTotal {};
+
+      /// Add a sample to the histogram                                       
+      ///   @param time - the sample                                          
+      void Add(Nanoseconds time) noexcept {
+         const auto us = static_cast<::std::uint64_t>(time.count() / 1000);
+         const auto bucket = ::std::bit_width(us);
+         ++mBuckets[bucket < Buckets ? bucket : Buckets - 1];
+         ++mSamples;
+         mTotal += time;
+      }
+
+      /// Get the average sample                                              
+      ///   @return the average sample                                        
+      Nanoseconds GetAverage() const noexcept {
+         return mSamples ? mTotal / mSamples : Nanoseconds {};
+      }
+   };
+
+
+   ///                                                                        
+   ///   Window statistics                                                    
+   ///                                                                        
+   /// Always-on counters, cheap enough to be maintained in production        
+   ///                                                                        
+   struct WindowStats {
+      // Raw events processed, per raw event type                       
+      ::std::array<Count, RawEvent::TypeCount> mEvents {};
+      // Raw events ignored by the IsInteractable/IsClosed guards, per type
+      ::std::array<Count, RawEvent::TypeCount> mIgnored {};
+      // Geometry changes overwritten by newer ones in the same frame   
+      Count mCoalesced = 0;
+      // Events dropped before queuing, because nothing handles them    
+      Count mUnhandled = 0;
+      // Dropped files that no longer existed when resolved             
+      Count mMissingDrops = 0;
+      // Batched dispatches of the hierarchy, one per frame at most     
+      Histogram mDispatch;
+      // Time from OS callback to dispatch, for every dispatched event  
+      Histogram mLatency;
+      // Events carried by all dispatches                               
+      Count mDispatchedEvents = 0;
+   };
+
+
+   ///                                                                        
+   ///   Module startup timings                                               
+   ///                                                                        
+   struct StartupStats {
+      // Time spent in the module constructor                           
+      Nanoseconds mLoad {};
+      // Time spent initializing GLFW, on first use                     
+      Nanoseconds mInit {};
+      // Time from module construction, until the first window is shown 
+      Nanoseconds mFirstWindow {};
+   };
+
+
+   ///                                                                        
+   ///   Platform statistics                                                  
+   ///                                                                        
+   struct PlatformStats {
+      StartupStats mStartup;
+      // Time spent polling or waiting for OS events in Platform::Update
+      Histogram mPoll;
+      // Time spent updating windows in Platform::Update                
+      Histogram mUpdate;
+   };
+
+} // namespace GLFW
@@ -7,8 +7,10 @@
 ///                                                                           
 #include "Window.hpp"
 #include "Platform.hpp"
+#include "Keys.inl"
 #include <Flow/Verbs/Interact.hpp>
 #include <Flow/Verbs/Interpret.hpp>
+#include <Flow/Verbs/Select.hpp>
 #include <Entity/Event.hpp>
 #include <GLFW/glfw3native.h>
 
@@ -19,6 +21,10 @@ namespace GLFW
    /// Get native window handle as type-erased void pointer                   
    ///   @param window - GLFW window interface to extract handle from         
    inline void* GetNativeWindowPointer(GLFWwindow* window) {
+      // Headless windows have no native counterpart                    
+      if (glfwGetPlatform() == GLFW_PLATFORM_NULL)
+         return nullptr;
+
       #if LANGULUS_OS(WINDOWS)
          return glfwGetWin32Window(window);
       #elif LANGULUS_OS(LINUX)
@@ -40,6 +46,7 @@ namespace GLFW
    void OnResolutionChange(GLFWwindow*, int x, int y);
    void OnHover(GLFWwindow*, int entered);
    void OnMouseKey(GLFWwindow*, int button, int action, int mods);
+   void OnMouseMove(GLFWwindow*, double x, double y);
    void OnMouseScroll(GLFWwindow*, double xoffset, double yoffset);
    void OnTextInput(GLFWwindow*, unsigned int codepoint);
    void OnFileDrop(GLFWwindow*, int count, const char** paths);
@@ -57,6 +64,74 @@ namespace GLFW
       SeekValueAux(descriptor, mSize);
       SeekValueAux(descriptor, mTitle);
 
+      // Make sure the poller isn't touching GLFW while we do           
+      const auto lock = producer->LockBackend();
+
+      // Reuse a hidden window from the pool, if available              
+      mGLFWWindow = producer->AcquireWindow(
+         int((*mSize)[0]), int((*mSize)[1]), mTitle->Terminate());
+      if (not mGLFWWindow)
+         CreateNativeWindow();
+
+      // Set the user pointer inside GLFWWindow to carry this interface 
+      glfwSetWindowUserPointer(mGLFWWindow, this);
+
+      // Query the initial window state once - it is maintained by the  
+      // callbacks from now on                                          
+      mClosed = QueryAttribute(GLFW_VISIBLE) == GLFW_FALSE;
+      mFocused = QueryAttribute(GLFW_FOCUSED) == GLFW_TRUE;
+      mHovered = QueryAttribute(GLFW_HOVERED) == GLFW_TRUE;
+      mMinimized = QueryAttribute(GLFW_ICONIFIED) == GLFW_TRUE;
+
+      double mouseX, mouseY;
+      glfwGetCursorPos(mGLFWWindow, &mouseX, &mouseY);
+      mCursorPosition = Vec2 {mouseX, mouseY};
+
+      // Delay resize events until size settles, if requested           
+      Time debounce {};
+      if (SeekValueAux<Traits::ResizeDebounce>(descriptor, debounce))
+         mResizeDebounce = ::std::chrono::duration_cast<
+            ::std::chrono::nanoseconds>(debounce);
+
+      // Drop events nothing handles, if requested                      
+      SeekValueAux<Traits::FilterUnhandled>(descriptor, mFilterUnhandled);
+
+      // Capture the mouse, if requested                                
+      bool relativeMouse = false;
+      if (SeekValueAux<Traits::RelativeMouse>(descriptor, relativeMouse))
+         SetRelativeMouse(relativeMouse);
+
+      // Use a cursor, if one was provided                              
+      SeekValueAux(descriptor, mCursor);
+      if (mCursor->Get())
+         SetCursor(mCursor->Get());
+
+      // Go fullscreen, if a monitor was provided                       
+      SeekValueAux(descriptor, mMonitor);
+      if (mMonitor->Get())
+         SetMonitor(mMonitor->Get());
+
+      // Start recording or replaying input, if requested               
+      Text recording, replay;
+      if (SeekValueAux<Traits::RecordInput>(descriptor, recording))
+         StartRecording(recording);
+      if (SeekValueAux<Traits::ReplayInput>(descriptor, replay))
+         StartReplay(replay);
+
+      mNativeWindowHandle = GetNativeWindowPointer(mGLFWWindow);
+      Couple(descriptor);
+
+      // Closed windows are not updated anymore                         
+      if (not mClosed)
+         producer->Activate(this);
+
+      VERBOSE_GLFW("Initialized");
+   }
+
+   /// Create a new native window, when there's none in the pool to reuse     
+   /// Callbacks are set only once per native window, and stay set while it's 
+   /// pooled, because they ignore windows without a user pointer             
+   void Window::CreateNativeWindow() {
       // Make it visible                                                
       glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
       glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
@@ -70,7 +145,7 @@ namespace GLFW
 
       LANGULUS_ASSERT(mGLFWWindow, Construct, "Failed to initialize window");
 
-      // Set the callbacks and user pointers for the canvas pipe        
+      // Set the callbacks for the canvas pipe                          
       glfwSetWindowCloseCallback(mGLFWWindow, OnClosed);
       glfwSetKeyCallback(mGLFWWindow, OnKeyboardKey);
       glfwSetWindowPosCallback(mGLFWWindow, OnMove);
@@ -80,13 +155,11 @@ namespace GLFW
       glfwSetFramebufferSizeCallback(mGLFWWindow, OnResolutionChange);
       glfwSetCursorEnterCallback(mGLFWWindow, OnHover);
       glfwSetMouseButtonCallback(mGLFWWindow, OnMouseKey);
+      glfwSetCursorPosCallback(mGLFWWindow, OnMouseMove);
       glfwSetScrollCallback(mGLFWWindow, OnMouseScroll);
       glfwSetCharCallback(mGLFWWindow, OnTextInput);
       glfwSetDropCallback(mGLFWWindow, OnFileDrop);
 
-      // Set the user pointer inside GLFWWindow to carry this interface 
-      glfwSetWindowUserPointer(mGLFWWindow, this);
-
       // Raw mouse motion is closer to the actual motion of the mouse   
       // across a surface. It is not affected by the scaling and        
       // acceleration applied to the motion of the desktop cursor.      
@@ -96,11 +169,6 @@ namespace GLFW
       // disabled.                                                      
       if (glfwRawMouseMotionSupported())
          glfwSetInputMode(mGLFWWindow, GLFW_RAW_MOUSE_MOTION, GLFW_TRUE);
-
-      mNativeWindowHandle = GetNativeWindowPointer(mGLFWWindow);
-      Couple(descriptor);
-
-      VERBOSE_GLFW("Initialized");
    }
 
    /// Move-construct window                                                  
@@ -128,8 +196,11 @@ namespace GLFW
 
    /// Window destruction                                                     
    Window::~Window() {
+      GetProducer()->Deactivate(this);
+
       if (mGLFWWindow) {
-         glfwDestroyWindow(mGLFWWindow);
+         // Return the native window to the pool, or destroy it         
+         GetProducer()->ReleaseWindow(mGLFWWindow);
          mGLFWWindow = nullptr;
          mNativeWindowHandle = nullptr;
       }
@@ -137,10 +208,16 @@ namespace GLFW
 
    /// Refresh the window component on environment change                     
    void Window::Refresh() {
+      // Units might have been added or removed below, so handlers must 
+      // be discovered anew                                             
+      mSubscriptions.clear();
+
       // Refresh unpinned properties from hierarchy                     
       SeekValue(mSize);
-      if (SeekValue(mTitle))
+      if (SeekValue(mTitle)) {
+         const auto lock = GetProducer()->LockBackend();
          glfwSetWindowTitle(mGLFWWindow, mTitle->Terminate().GetRaw());
+      }
    }
 
    /// Associate some specific traits of a window                             
@@ -152,58 +229,738 @@ namespace GLFW
          if (trait.IsTrait<Traits::Clipboard>()) {
             // Update system clipboard                                  
             mClipboard = trait.AsCast<Text>().Terminate();
-            glfwSetClipboardString(mGLFWWindow, mClipboard->GetRaw());
+            const auto lock = GetProducer()->LockBackend();
+            glfwSetClipboardString(mGLFWWindow, mClipboard.GetRaw());
+            mClipboardHash = HashOf(Token {mClipboard});
+            mClipboardStale = false;
+            ++mClipboardGeneration;
+         }
+         else if (trait.IsTrait<Traits::Cursor>()) {
+            if (trait.Is<bool>()) {
+               // Show or hide the cursor. A captured cursor stays      
+               // disabled, and the change is applied once released     
+               mCursorVisible = trait.AsCast<bool>();
+               if (not mRelativeMouse) {
+                  const auto lock = GetProducer()->LockBackend();
+                  glfwSetInputMode(mGLFWWindow, GLFW_CURSOR, mCursorVisible
+                     ? GLFW_CURSOR_NORMAL : GLFW_CURSOR_HIDDEN);
+               }
+            }
+            else SetCursor(trait.IsEmpty() ? nullptr : trait.As<Cursor*>());
+         }
+         else if (trait.IsTrait<Traits::RelativeMouse>())
+            SetRelativeMouse(trait.AsCast<bool>());
+         else if (trait.IsTrait<Traits::FilterUnhandled>()) {
+            // Handlers are discovered anew when filtering is enabled   
+            mFilterUnhandled = trait.AsCast<bool>();
+            mSubscriptions.clear();
+         }
+         else if (trait.IsTrait<Traits::Monitor>()) {
+            // Switch to fullscreen on a monitor, or back to windowed   
+            SetMonitor(trait.IsEmpty() ? nullptr : trait.As<Monitor*>());
          }
       });
    }
 
-   /// Update the window                                                      
-   void Window::Update() {
-      if (not mGLFWWindow)
+   /// Produce traits on request                                              
+   /// The clipboard is fetched from the system only if it might have changed 
+   /// outside of this window, which is why it isn't a reflected member       
+   ///   @param verb - the selection verb                                     
+   void Window::Select(Verb& verb) {
+      verb.ForEachDeep([&](const TMeta& trait) {
+         if (trait->Is<Traits::Clipboard>())
+            verb << Traits::Clipboard {GetClipboard()};
+      });
+   }
+
+   /// Capture the cursor and report unaccelerated relative motion, or        
+   /// release it. While captured, the cursor is hidden and isn't limited by  
+   /// the window edges, and raw motion is used, if supported. When released, 
+   /// the cursor is shown or hidden, as last requested via Traits::Cursor    
+   ///   @param enabled - whether to enable relative mouse mode               
+   void Window::SetRelativeMouse(bool enabled) {
+      if (mRelativeMouse == enabled)
          return;
 
-      // Expose the current clipboard - it might be used by other       
-      // modules, like UI for example                                   
-      mClipboard = Text {glfwGetClipboardString(mGLFWWindow)};
-
-      // Update gradients, even if window is not interactable           
-      mMousePosition->Update();
-      mMouseScroll->Update();
-
-      if (IsInteractable() and IsMouseOver()) {
-         // Handle mouse movement                                       
-         double mouseX, mouseY;
-         glfwGetCursorPos(mGLFWWindow, &mouseX, &mouseY);
-         mMousePosition->Current() = Vec2 {mouseX, mouseY};
-
-         // Handle mouse scroll                                         
-         mMouseScroll->Current() += mScrollChange;
-         mScrollChange = {};
-
-         // Check if mouse position has changed, and add specific events
-         auto md = mMousePosition->Delta();
-         if (md) {
-            // Any mouse movement                                       
-            Verbs::Interact interact {Events::MouseMove{md}};
-            RunIn<Seek::HereAndBelow>(interact);
+      mRelativeMouse = enabled;
+      mRelativeMotion = {};
+      mRelativeMotionValid = false;
+
+      const auto lock = GetProducer()->LockBackend();
+      glfwSetInputMode(mGLFWWindow, GLFW_CURSOR, enabled
+         ? GLFW_CURSOR_DISABLED
+         : mCursorVisible ? GLFW_CURSOR_NORMAL : GLFW_CURSOR_HIDDEN);
+   }
+
+   /// Change the cursor shown over the window                                
+   /// Native cursors are cached by the platform, so this is usually only a   
+   /// pointer swap, and the backend is touched only if the cursor changed    
+   ///   @param cursor - the cursor to use, or nullptr for the default one    
+   void Window::SetCursor(Cursor* cursor) {
+      mCursor = cursor;
+      const auto handle = cursor ? cursor->GetHandle() : nullptr;
+      if (handle == mCurrentCursor)
+         return;
+
+      mCurrentCursor = handle;
+      const auto lock = GetProducer()->LockBackend();
+      glfwSetCursor(mGLFWWindow, handle);
+   }
+
+   /// Forget a native cursor that is about to be destroyed, so that it isn't 
+   /// mistaken for a new cursor that happens to reuse its address            
+   ///   @param handle - the native cursor                                    
+   void Window::ForgetCursor(GLFWcursor* handle) noexcept {
+      if (mCurrentCursor == handle)
+         mCurrentCursor = nullptr;
+   }
+
+   /// Switch to exclusive fullscreen on a monitor, or back to windowed mode  
+   /// The video mode that best fits the window size is picked from the       
+   /// monitor cache, so the display server isn't queried for modes           
+   ///   @param monitor - the monitor to go fullscreen on, or nullptr         
+   void Window::SetMonitor(Monitor* monitor) {
+      const auto info = monitor ? monitor->GetInfo() : nullptr;
+      const auto mode = info ? info->PickMode(
+         int((*mSize)[0]), int((*mSize)[1])) : nullptr;
+
+      const auto lock = GetProducer()->LockBackend();
+      if (mode) {
+         if (not glfwGetWindowMonitor(mGLFWWindow)) {
+            // Remember where to return to                              
+            glfwGetWindowPos(mGLFWWindow,
+               &mWindowedPosition[0], &mWindowedPosition[1]);
+         }
+
+         mMonitor = monitor;
+         glfwSetWindowMonitor(mGLFWWindow, info->mHandle, 0, 0,
+            mode->width, mode->height, mode->refreshRate);
+      }
+      else if (glfwGetWindowMonitor(mGLFWWindow)) {
+         mMonitor = nullptr;
+         glfwSetWindowMonitor(mGLFWWindow, nullptr,
+            mWindowedPosition[0], mWindowedPosition[1],
+            int((*mSize)[0]), int((*mSize)[1]), GLFW_DONT_CARE);
+      }
+   }
+
+   /// Queue an event for dispatching on the next Update                      
+   /// Events of types that no unit in the hierarchy handles are dropped      
+   ///   @param event - the event to queue                                    
+   template<class E>
+   void Window::PushEvent(E&& event) {
+      if (Subscribed(MetaDataOf<Decay<E>>()))
+         mEventPool.Push(mEvents, Forward<E>(event));
+   }
+
+   /// Queue events produced outside the window, like gamepad events          
+   ///   @param events - the events to queue                                  
+   ///   @param time - when the events were received                          
+   void Window::PushEvents(const TMany<Many>& events, SteadyTime time) {
+      for (auto& event : events) {
+         if (Subscribed(event.GetType()))
+            mEvents << event;
+      }
+
+      Stamp(time);
+   }
+
+   /// Check if an event type was dispatched before, and nothing handled it   
+   ///   @param type - the event type                                         
+   ///   @return true if event type is known to be unhandled                  
+   bool Window::IsUnhandled(DMeta type) const noexcept {
+      if (not mFilterUnhandled)
+         return false;
+
+      for (auto& [known, handled] : mSubscriptions) {
+         if (known == type)
+            return not handled;
+      }
+      return false;
+   }
+
+   /// Check if events of a type should be queued, counting those that aren't 
+   ///   @param type - the event type                                         
+   ///   @return true if event type isn't known to be unhandled               
+   bool Window::Subscribed(DMeta type) noexcept {
+      if (not IsUnhandled(type))
+         return true;
+
+      ++mStats.mUnhandled;
+      return false;
+   }
+
+   /// Dispatch all queued events to the hierarchy                            
+   /// The verb shares the event list instead of taking it, so that the list  
+   /// and the pooled event containers are reused once the verb is gone.      
+   /// Usually all events are carried by a single interact verb. If event     
+   /// filtering is enabled, and an event type is seen for the first time     
+   /// since the last refresh, events are instead dispatched one by one, in   
+   /// order, to discover which types are handled by anything in the          
+   /// hierarchy. A type is considered handled only if a unit marks the       
+   /// interact verb done, so with filtering enabled, units must call Done on 
+   /// every event they react to, or they won't receive that type again,      
+   /// until the next Refresh. Each verb ends with an EventTiming argument,   
+   /// holding the latency of the events that precede it                      
+   void Window::Dispatch() {
+      mStats.mDispatchedEvents += mEvents.GetCount();
+
+      // Stamp the dispatch, and measure the latency of every event     
+      const auto now = ::std::chrono::steady_clock::now();
+      auto& timing = PrepareTiming(now);
+      for (auto& captured : mEventTimes)
+         mStats.mLatency.Add(now - captured);
+
+      bool discover = false;
+      if (mFilterUnhandled) {
+         for (auto& event : mEvents) {
+            const auto type = event.GetType();
+            bool known = false;
+            for (auto& subscription : mSubscriptions) {
+               if (subscription.first == type) {
+                  known = true;
+                  break;
+               }
+            }
+
+            if (not known) {
+               discover = true;
+               break;
+            }
          }
+      }
+
+      if (not discover) {
+         for (auto& captured : mEventTimes)
+            timing.mLatency << Time {now - captured};
 
-         // Check if mouse scroll has changed, and add specific events  
-         auto ms = mMouseScroll->Delta();
-         if (ms) {
-            // Any mouse scrolling                                      
-            Verbs::Interact interact {Events::MouseScroll{ms}};
+         mEvents << mTiming;
+         {
+            Verbs::Interact interact {mEvents};
             RunIn<Seek::HereAndBelow>(interact);
          }
+         mEventTimes.clear();
+         mEvents.Clear();
+         return;
       }
 
-      if (mTextInput) {
-         // Interact using queried text input for the window            
-         Verbs::Interact interact {Events::WindowText{Move(mTextInput)}};
+      for (Offset i = 0; i < mEvents.GetCount(); ++i) {
+         auto& event = mEvents[i];
+         const auto type = event.GetType();
+         timing.mLatency.Clear();
+         timing.mLatency << Time {now - mEventTimes[i]};
+
+         mSingleEvent << event << mTiming;
+         Verbs::Interact interact {mSingleEvent};
          RunIn<Seek::HereAndBelow>(interact);
+         mSingleEvent.Clear();
+
+         auto found = false;
+         for (auto& [known, handled] : mSubscriptions) {
+            if (known == type) {
+               handled |= interact.IsDone();
+               found = true;
+               break;
+            }
+         }
+
+         if (not found)
+            mSubscriptions.emplace_back(type, interact.IsDone());
+      }
+
+      mEventTimes.clear();
+      mEvents.Clear();
+   }
+
+   /// Get an empty timing event to append to dispatched verbs                
+   /// The previous one is reused, unless something still references it       
+   ///   @param time - when the dispatch started                              
+   ///   @return the timing event                                             
+   EventTiming& Window::PrepareTiming(SteadyTime time) {
+      if (not mTiming or mTiming.GetUses() != 1)
+         mTiming = Many {EventTiming {}};
+
+      auto& timing = mTiming.As<EventTiming>();
+      timing.mDispatchTime = time;
+      timing.mLatency.Clear();
+      return timing;
+   }
+
+   /// Stamp all events queued since the last stamp with a capture time       
+   ///   @param time - when the events were received from the OS              
+   void Window::Stamp(SteadyTime time) {
+      mEventTimes.resize(mEvents.GetCount(), time);
+   }
+
+   /// Update the window, dispatching all events gathered since the last      
+   /// update as a single batched interaction                                 
+   void Window::Update() {
+      if (not mGLFWWindow)
+         return;
+
+      // Process all raw events captured since the last update, in the  
+      // order they were received from the OS. The cursor history is    
+      // restarted, so that it contains only the newest samples         
+      mCursorHistoryCount = 0;
+      // Edges are reported only for the frame they happened in         
+      mButtons->ClearEdges();
+      // The dispatched text stays referenced by its pooled event, until
+      // the event container is reused for the next text. So text is    
+      // accumulated in the other buffer, which by then is referenced   
+      // only by us, and is cleared with its capacity kept. If the text 
+      // is still held by a consumer, clearing releases it instead      
+      if (mTextDispatched) {
+         ::std::swap(mTextInput, mTextSpare);
+         mTextDispatched = false;
+      }
+      mTextInput.Clear();
+
+      if (mReplay) {
+         // Feed recorded events through the same path the OS does      
+         mReplay->Feed(*this);
+         if (mReplay->IsDone())
+            mReplay.reset();
+      }
+
+      // Events produced by a raw event carry its capture time          
+      RawEvent raw;
+      while (mInput.Pop(raw)) {
+         Process(raw);
+         Stamp(raw.mTime);
+      }
+
+      if (not IsClosed()) {
+         // Update gradients, even if window is not interactable        
+         mMousePosition->Update();
+         mMouseScroll->Update();
+
+         if (mRelativeMouse) {
+            // The cursor is captured, so motion is published even if   
+            // cursor isn't reported to hover the window                
+            if (IsInteractable() and mRelativeMotion) {
+               PushEvent(Events::MouseMove {mRelativeMotion});
+               Stamp(mLastMouseTime);
+            }
+            mRelativeMotion = {};
+         }
+
+         if (IsInteractable() and (IsMouseOver() or mRelativeMouse)) {
+            // Handle mouse movement, as reported by the last cursor    
+            // position callback                                        
+            mMousePosition->Current() = mCursorPosition;
+
+            // Handle mouse scroll                                      
+            mMouseScroll->Current() += mScrollChange;
+            mScrollChange = {};
+
+            // Check if mouse position has changed, and add specific    
+            // events, unless they were already accumulated in relative 
+            // mouse mode                                               
+            auto md = mMousePosition->Delta();
+            if (md and not mRelativeMouse) {
+               PushEvent(Events::MouseMove {md});
+               Stamp(mLastMouseTime);
+            }
+
+            // Check if mouse scroll has changed, and add specific      
+            // events                                                   
+            auto ms = mMouseScroll->Delta();
+            if (ms) {
+               PushEvent(Events::MouseScroll {ms});
+               Stamp(mLastScrollTime);
+            }
+         }
+
+         if (mTextInput) {
+            // Interact using queried text input for the window. The    
+            // event shares the buffer, instead of taking it, so that   
+            // the buffer's memory is reused two frames later           
+            PushEvent(Events::WindowText {mTextInput});
+            mTextDispatched = true;
+            Stamp(mLastTextTime);
+         }
+      }
+
+      // Deliver only the last geometry change of the frame             
+      FlushGeometry();
+
+      // Dropped files are stamped when their chunk gets delivered      
+      DeliverDrops();
+      Stamp(::std::chrono::steady_clock::now());
+
+      if (mEvents) {
+         // Walk the hierarchy once for all events of this frame - the  
+         // ordered event list is carried by a single interact verb.    
+         // Events are dispatched even if window got closed during the  
+         // last poll, so that the hierarchy is notified about it       
+         const auto start = ::std::chrono::steady_clock::now();
+         Dispatch();
+         mStats.mDispatch.Add(::std::chrono::steady_clock::now() - start);
       }
    }
 
+   /// Deliver at most one chunk of dropped files, whose metadata is resolved 
+   /// Files that no longer exist are skipped. Each chunk is copied in a      
+   /// single text, and every path in the event is a view into it             
+   void Window::DeliverDrops() {
+      while (not mDrops.empty()) {
+         auto& drop = *mDrops.front();
+         if (drop.IsDelivered()) {
+            mDrops.pop_front();
+            continue;
+         }
+
+         const auto count = ::std::min(FileDrop::ChunkSize, drop.GetReady());
+         if (not count)
+            return;
+
+         const auto first = drop.Deliver(count);
+         const auto begin = drop.GetPath(first).data();
+         const auto last = drop.GetPath(first + count - 1);
+         const Text chunk {Token {begin, last.data() + last.size() - begin}};
+
+         // All paths are delivered, followed by their metadata, so that
+         // consumers can tell which ones no longer exist               
+         Events::WindowFileDrop dropped;
+         WindowFileInfo info;
+         for (Offset i = first; i < first + count; ++i) {
+            const auto path = drop.GetPath(i);
+            dropped.mPayload << chunk.Crop(path.data() - begin, path.size());
+
+            const auto& file = drop.GetFile(i);
+            if (not file.mExists)
+               ++mStats.mMissingDrops;
+            info.mFiles << file;
+         }
+
+         PushEvent(Move(dropped));
+         PushEvent(Move(info));
+         return;
+      }
+   }
+
+   /// Remember a geometry change, overwriting any previous undelivered one   
+   ///   @param geometry - [in/out] the pending geometry change               
+   ///   @param raw - the raw geometry event                                  
+   void Window::Coalesce(Geometry& geometry, const RawEvent& raw) noexcept {
+      if (geometry.mPending)
+         ++mStats.mCoalesced;
+
+      geometry.mValue = Vec2(raw.mInt[0], raw.mInt[1]);
+      geometry.mTime = raw.mTime;
+      geometry.mPending = true;
+   }
+
+   /// Deliver pending geometry changes. Moves are delivered on each update,  
+   /// while resizes and resolution changes wait until the size has settled   
+   /// for the debounce period, if one was provided. Nothing is delivered     
+   /// after the window is closed                                             
+   void Window::FlushGeometry() {
+      if (mClosed) {
+         mPendingMove.mPending = false;
+         mPendingResize.mPending = false;
+         mPendingResolution.mPending = false;
+         return;
+      }
+
+      const auto now = ::std::chrono::steady_clock::now();
+      const auto settled = [&](const Geometry& geometry) {
+         return geometry.mPending
+            and now - geometry.mTime >= mResizeDebounce;
+      };
+
+      if (mPendingMove.mPending) {
+         PushEvent(Events::WindowMove {mPendingMove.mValue});
+         Stamp(mPendingMove.mTime);
+         mPendingMove.mPending = false;
+      }
+
+      if (settled(mPendingResize)) {
+         // Update hierarchy                                            
+         SetSize(int(mPendingResize.mValue[0]), int(mPendingResize.mValue[1]));
+         PushEvent(Events::WindowResize {mPendingResize.mValue});
+         Stamp(mPendingResize.mTime);
+         mPendingResize.mPending = false;
+      }
+
+      if (settled(mPendingResolution)) {
+         PushEvent(Events::WindowResolutionChange {mPendingResolution.mValue});
+         Stamp(mPendingResolution.mTime);
+         mPendingResolution.mPending = false;
+      }
+   }
+
+   /// Get the time until pending geometry changes settle, so that the        
+   /// platform knows how long it can wait for events                         
+   ///   @return zero if they already have, or the maximum duration if no     
+   ///           change is waiting for the debounce period                    
+   ::std::chrono::nanoseconds Window::GetSettleTime() const noexcept {
+      using ::std::chrono::nanoseconds;
+      const auto now = ::std::chrono::steady_clock::now();
+      auto remaining = nanoseconds::max();
+      for (auto geometry : {&mPendingResize, &mPendingResolution}) {
+         if (not geometry->mPending)
+            continue;
+
+         const auto left = ::std::chrono::duration_cast<nanoseconds>(
+            geometry->mTime + mResizeDebounce - now);
+         remaining = ::std::min(remaining, ::std::max(left, nanoseconds {}));
+      }
+      return remaining;
+   }
+
+   /// Check if a raw event passes a guard, and count it if it doesn't        
+   ///   @param raw - the raw event                                           
+   ///   @param admitted - the guard result                                   
+   ///   @return the guard result                                             
+   bool Window::Accept(const RawEvent& raw, bool admitted) noexcept {
+      if (not admitted)
+         ++mStats.mIgnored[raw.mType];
+      return admitted;
+   }
+
+   /// Process a raw event, updating the window state and queuing the         
+   /// corresponding Langulus events for dispatch                             
+   ///   @param raw - the raw event to process                                
+   void Window::Process(const RawEvent& raw) {
+      // File drops are recorded along with their paths, further below  
+      if (mRecorder and raw.mType != RawEvent::Drop)
+         mRecorder->Write(raw);
+      ++mStats.mEvents[raw.mType];
+
+      switch (raw.mType) {
+      case RawEvent::Closed:
+         if (not Accept(raw, IsInteractable()))
+            break;
+
+         {
+            const auto lock = GetProducer()->LockBackend();
+            glfwHideWindow(mGLFWWindow);
+         }
+
+         // Geometry changes pending from before the close are dropped  
+         mClosed = true;
+         PushEvent(Events::WindowClose {GetNativeHandle()});
+         break;
+
+      case RawEvent::Key:
+         // Track held keys even if not interactable, so releases are   
+         // never missed                                                
+         if (raw.mInt[2] != GLFW_REPEAT)
+            mButtons->Set(raw.mInt[0], raw.mInt[2] == GLFW_PRESS);
+         if (not Accept(raw, IsInteractable()))
+            break;
+
+         // Translate with a single indexed load, unless nothing in the 
+         // hierarchy handles the resulting event                       
+         Inner::TranslateCode(
+            Inner::KeyboardTable, raw.mInt[0], mEvents, EventState {},
+            &mEventPool, [this](DMeta type) { return Subscribed(type); }
+         );
+         break;
+
+      case RawEvent::MouseKey:
+         mButtons->Set(ButtonState::MouseOffset + raw.mInt[0],
+            raw.mInt[1] == GLFW_PRESS);
+         if (not Accept(raw, IsInteractable()))
+            break;
+
+         // Translate with a single indexed load, unless nothing in the 
+         // hierarchy handles the resulting event                       
+         Inner::TranslateCode(
+            Inner::MouseTable, raw.mInt[0], mEvents, EventState {},
+            &mEventPool, [this](DMeta type) { return Subscribed(type); }
+         );
+         break;
+
+      case RawEvent::Move:
+         if (Accept(raw, IsInteractable()))
+            Coalesce(mPendingMove, raw);
+         break;
+
+      case RawEvent::Resize:
+         if (Accept(raw, IsInteractable()))
+            Coalesce(mPendingResize, raw);
+         break;
+
+      case RawEvent::Resolution:
+         if (Accept(raw, not IsClosed()))
+            Coalesce(mPendingResolution, raw);
+         break;
+
+      case RawEvent::Focus:
+         mFocused = raw.mInt[0] == GLFW_TRUE;
+         if (not Accept(raw, not IsClosed()))
+            break;
+
+         // Clipboard might change only while we're out of focus, so    
+         // fetch it when we gain focus, and consider it stale while    
+         // we aren't                                                   
+         if (mFocused) {
+            FetchClipboard();
+            PushEvent(Events::WindowFocus {GetNativeHandle()});
+         }
+         else {
+            // Keys released while out of focus are never reported      
+            mButtons->ReleaseAll();
+            mClipboardStale = true;
+            PushEvent(Events::WindowUnfocus {GetNativeHandle()});
+         }
+         break;
+
+      case RawEvent::Minimize:
+         mMinimized = raw.mInt[0] == GLFW_TRUE;
+         if (not Accept(raw, IsInteractable()))
+            break;
+
+         if (mMinimized)
+            PushEvent(Events::WindowMinimize {GetNativeHandle()});
+         else
+            PushEvent(Events::WindowMaximize {GetNativeHandle()});
+         break;
+
+      case RawEvent::Hover:
+         mHovered = raw.mInt[0] == GLFW_TRUE;
+         if (not Accept(raw, IsInteractable()))
+            break;
+
+         if (mHovered)
+            PushEvent(Events::WindowMouseHoverIn {GetNativeHandle()});
+         else
+            PushEvent(Events::WindowMouseHoverOut {GetNativeHandle()});
+         break;
+
+      case RawEvent::MouseMove: {
+         const Vec2 position {raw.mReal[0], raw.mReal[1]};
+         if (mRelativeMouse) {
+            // Accumulate every sub-frame delta. The first sample after 
+            // capturing the cursor is skipped, because GLFW may warp   
+            // the cursor when disabling it                             
+            if (mRelativeMotionValid)
+               mRelativeMotion += position - mCursorPosition;
+            mRelativeMotionValid = true;
+         }
+
+         mCursorPosition = position;
+         mLastMouseTime = raw.mTime;
+         RecordCursor(CursorSample::Position, raw);
+      } break;
+
+      case RawEvent::Scroll:
+         mLastScrollTime = raw.mTime;
+         RecordCursor(CursorSample::Scroll, raw);
+         if (Accept(raw, IsInteractable()))
+            AccumulateScroll({raw.mReal[0], raw.mReal[1]});
+         break;
+
+      case RawEvent::Char:
+         if (not Accept(raw, IsInteractable()))
+            break;
+
+         mLastTextTime = raw.mTime;
+         PushCodepoint(static_cast<char32_t>(raw.mInt[0]));
+         break;
+
+      case RawEvent::Drop: {
+         ::std::unique_ptr<FileDrop> drop;
+         {
+            const ::std::scoped_lock lock {mDropMutex};
+            if (mDropStaging.empty())
+               break;
+            drop = Move(mDropStaging.front());
+            mDropStaging.pop_front();
+         }
+
+         if (mRecorder)
+            mRecorder->Write(raw, drop.get());
+
+         if (not Accept(raw, IsInteractable()))
+            break;
+
+         // Paths are delivered in chunks on the following updates, as  
+         // their metadata gets resolved in the background              
+         drop->Resolve();
+         mDrops.emplace_back(Move(drop));
+      } break;
+      }
+   }
+
+   /// Record a cursor sample in the cursor history                           
+   ///   @param kind - the kind of sample                                     
+   ///   @param raw - the raw event to record                                 
+   void Window::RecordCursor(
+      CursorSample::Kind kind, const RawEvent& raw
+   ) noexcept {
+      if (mCursorHistoryCount == CursorHistorySize) {
+         ++mCursorHistoryOverflow;
+         return;
+      }
+
+      mCursorHistory[mCursorHistoryCount++] = {
+         kind, raw.mTime, raw.mReal[0], raw.mReal[1]
+      };
+   }
+
+   /// Start recording all raw input to a file                                
+   /// An existing recording is overwritten, because times are relative to    
+   /// the start of the recording                                             
+   ///   @param path - the file to record to                                  
+   void Window::StartRecording(const Text& path) {
+      mRecorder = ::std::make_unique<InputRecorder>(path);
+   }
+
+   /// Stop recording raw input                                               
+   void Window::StopRecording() {
+      mRecorder.reset();
+   }
+
+   /// Start replaying raw input from a recording                             
+   /// User input from the OS is ignored until the replay is done             
+   /// Replayed events are captured on update, so replay isn't possible while 
+   /// the poller thread captures events, too - the input ring has a single   
+   /// producer                                                               
+   ///   @param path - the recording to replay                                
+   ///   @param realtime - whether to replay with original timing, or as fast 
+   ///                     as the window can process the events               
+   void Window::StartReplay(const Text& path, bool realtime) {
+      if (GetProducer()->IsInputThreaded()) {
+         Logger::Warning(Self(), "Input can't be replayed while threaded "
+            "input is enabled - replay ignored");
+         return;
+      }
+
+      mReplay = ::std::make_unique<InputReplay>(path, realtime);
+   }
+
+   /// Stop replaying raw input                                               
+   void Window::StopReplay() {
+      mReplay.reset();
+   }
+
+   /// Log the window statistics                                              
+   void Window::DumpStats() const {
+      const auto tab = Logger::InfoTab(Self(), "Window statistics:");
+      for (int type = 0; type < RawEvent::TypeCount; ++type) {
+         if (not mStats.mEvents[type])
+            continue;
+
+         Logger::Info("Raw event #", type, ": ", mStats.mEvents[type],
+            " processed, ", mStats.mIgnored[type], " ignored");
+      }
+
+      Logger::Info("Raw events lost to ring overflow: ", mInputOverflow.load());
+      Logger::Info("Cursor samples lost to history overflow: ",
+         mCursorHistoryOverflow);
+      Logger::Info("Events without handlers: ", mStats.mUnhandled);
+      Logger::Info("Dropped files that were missing: ", mStats.mMissingDrops);
+      Logger::Info("Geometry changes coalesced: ", mStats.mCoalesced);
+      Logger::Info("Input latency: ",
+         mStats.mLatency.GetAverage().count(), "ns on average");
+      Logger::Info("Dispatches: ", mStats.mDispatch.mSamples, ", carrying ",
+         mStats.mDispatchedEvents, " events, ",
+         mStats.mDispatch.GetAverage().count(), "ns on average");
+   }
+
    /// Set window size and notify the hierarchy of the change                 
    ///   @param x - horizontal size                                           
    ///   @param y - vertical size                                             
@@ -211,23 +968,63 @@ namespace GLFW
       mSize = Scale2 {x, y};
    }
 
-   /// Check if window is closed                                              
-   bool Window::IsClosed() const {
-      return glfwGetWindowAttrib(mGLFWWindow, GLFW_VISIBLE) == GLFW_FALSE;
+   /// Query a window attribute from the backend                              
+   /// This is a round-trip to the OS (an X11 query on Linux), so avoid it    
+   ///   @param attribute - the GLFW attribute to query                       
+   ///   @return the attribute value                                          
+   int Window::QueryAttribute(int attribute) {
+      ++mAttributeQueries;
+      return glfwGetWindowAttrib(mGLFWWindow, attribute);
    }
 
-   /// Check if window is in focus                                            
-   bool Window::IsInFocus() const {
-      return glfwGetWindowAttrib(mGLFWWindow, GLFW_FOCUSED) == GLFW_TRUE;
+   /// Fetch the system clipboard, if it differs from what we have            
+   /// This is a round-trip to the OS (a selection conversion on X11), so it  
+   /// is done only on focus-gain, or when clipboard is explicitly requested  
+   void Window::FetchClipboard() {
+      mClipboardStale = false;
+      const auto lock = GetProducer()->LockBackend();
+      const auto raw = glfwGetClipboardString(mGLFWWindow);
+      const Token contents = raw ? raw : "";
+      const auto hash = HashOf(contents);
+      if (hash == mClipboardHash and Token {mClipboard} == contents)
+         return;
+
+      // Contents changed, so expose them                               
+      mClipboard = Text {contents};
+      mClipboardHash = hash;
+      ++mClipboardGeneration;
    }
 
-   /// Check if window is in focus                                            
-   bool Window::IsMouseOver() const {
-      return glfwGetWindowAttrib(mGLFWWindow, GLFW_HOVERED) == GLFW_TRUE;
+   /// Get the clipboard contents, fetching them only if they might have      
+   /// changed outside of this window                                         
+   ///   @return the clipboard contents                                       
+   const Text& Window::GetClipboard() {
+      if (mClipboardStale)
+         FetchClipboard();
+      return mClipboard;
+   }
+
+   /// Get all cursor position and scroll samples, received between the last  
+   /// two updates, in the order they were received                           
+   ///   @return the cursor samples                                           
+   ::std::span<const CursorSample> Window::GetCursorHistory() const noexcept {
+      return {mCursorHistory.data(), mCursorHistoryCount};
+   }
+
+   /// Get the clipboard generation, incremented on each clipboard change     
+   ///   @return the clipboard generation                                     
+   Count Window::GetClipboardGeneration() const noexcept {
+      return mClipboardGeneration;
+   }
+
+   /// Get the hash of the current clipboard contents                         
+   ///   @return the clipboard hash                                           
+   Hash Window::GetClipboardHash() const noexcept {
+      return mClipboardHash;
    }
 
    /// Check if window interacts on inputs                                    
-   bool Window::IsInteractable() const {
+   bool Window::IsInteractable() const noexcept {
       return not IsClosed() and IsInFocus() and not IsMinimized();
    }
 
@@ -236,6 +1033,15 @@ namespace GLFW
       mTextInput += text;
    }
 
+   /// Encode a single codepoint as UTF-8 directly into the text input buffer 
+   /// Invalid codepoints and surrogates are ignored                          
+   ///   @param codepoint - the UTF-32 codepoint                              
+   void Window::PushCodepoint(char32_t codepoint) {
+      char utf8[4];
+      if (const auto size = EncodeUTF8(codepoint, utf8))
+         mTextInput += Token {utf8, size};
+   }
+
    /// Accumulate mouse scrolling                                             
    void Window::AccumulateScroll(const Vec2& offset) noexcept {
       mScrollChange += offset;
@@ -256,408 +1062,53 @@ namespace GLFW
    /// Check if window is minimized                                           
    ///   @return true if window is minimized                                  
    bool Window::IsMinimized() const noexcept {
-      return glfwGetWindowAttrib(mGLFWWindow, GLFW_ICONIFIED) == GLFW_TRUE;
+      return mMinimized;
    }
 
 
    ///                                                                        
    ///   CALLBACKS                                                            
    ///                                                                        
+   /// Callbacks are invoked by glfwPollEvents, which may be running on a     
+   /// dedicated thread. They only capture raw events, which are processed    
+   /// on the window's thread by Window::Process                              
+   /// Pooled windows have no Langulus window associated, and ignore events   
 
    /// Get the Langulus window associated with a GLFW window                  
+   ///   @return the window, or nullptr if GLFW window is pooled              
    LANGULUS(INLINED)
    auto GetUnit(GLFWwindow* window) {
       return static_cast<Window*>(glfwGetWindowUserPointer(window));
    }
 
+   /// Get the Langulus window associated with a GLFW window, for user input  
+   /// Input is ignored while a recording is being replayed, so that replay   
+   /// is deterministic. Window state changes still come through GetUnit      
+   ///   @return the window, or nullptr if pooled or replaying                
+   LANGULUS(INLINED)
+   Window* GetInputUnit(GLFWwindow* window) {
+      const auto unit = GetInputUnit(window);
+      return unit and not unit->IsReplaying() ? unit : nullptr;
+   }
+
    /// On window close                                                        
    ///   @param window - the event's owner                                    
    void OnClosed(GLFWwindow* window) {
-      auto canvas = GetUnit(window);
-      if (not canvas->IsInteractable())
-         return;
-
-      glfwHideWindow(window);
-
-      Verbs::Interact interact {
-         Events::WindowClose {canvas->GetNativeHandle()}
-      };
-      canvas->RunIn<Seek::HereAndBelow>(interact);
+      if (const auto unit = GetInputUnit(window))
+         unit->Capture({RawEvent::Closed});
    }
 
    /// On key/mouse press/move                                                
    ///   @param window - the event's owner                                    
    ///   @param key - the pressed/released key                                
-   ///   @param scancode - i don't know what the fuck this is                 
+   ///   @param scancode - platform-specific code of the key                  
    ///   @param action - pressed, released, repeated, etc...                  
-   ///   @param mods - i guess it has something to do with key combinations   
+   ///   @param mods - bit field describing which modifier keys were held     
    void OnKeyboardKey(
-      GLFWwindow* window, int key,
-      UNUSED() int scancode, UNUSED() int action, UNUSED() int mods
+      GLFWwindow* window, int key, int scancode, int action, int mods
    ) {
-      auto canvas = GetUnit(window);
-      if (not canvas->IsInteractable())
-         return;
-
-      Verbs::Interact interact {};
-      EventState state;
-
-      switch (key) {
-      case GLFW_KEY_SPACE:
-         interact.SetArgument(Keys::Space {state});
-         break;
-      case GLFW_KEY_APOSTROPHE:
-         interact.SetArgument(Keys::Apostrophe {state});
-         break;
-      case GLFW_KEY_COMMA:
-         interact.SetArgument(Keys::Comma {state});
-         break;
-      case GLFW_KEY_MINUS:
-         interact.SetArgument(Keys::Minus {state});
-         break;
-      case GLFW_KEY_PERIOD:
-         interact.SetArgument(Keys::Period {state});
-         break;
-      case GLFW_KEY_SLASH:
-         interact.SetArgument(Keys::Slash {state});
-         break;
-      case GLFW_KEY_BACKSLASH:
-         interact.SetArgument(Keys::Hack {state});
-         break;
-      case GLFW_KEY_SEMICOLON:
-         interact.SetArgument(Keys::Semicolon {state});
-         break;
-      case GLFW_KEY_LEFT_BRACKET:
-         interact.SetArgument(Keys::LeftBracket {state});
-         break;
-      case GLFW_KEY_RIGHT_BRACKET:
-         interact.SetArgument(Keys::RightBracket {state});
-         break;
-      case GLFW_KEY_GRAVE_ACCENT:
-         interact.SetArgument(Keys::Tilde {state});
-         break;
-
-      case GLFW_KEY_0:
-         interact.SetArgument(Keys::Main0 {state});
-         break;
-      case GLFW_KEY_1:
-         interact.SetArgument(Keys::Main1 {state});
-         break;
-      case GLFW_KEY_2:
-         interact.SetArgument(Keys::Main2 {state});
-         break;
-      case GLFW_KEY_3:
-         interact.SetArgument(Keys::Main3 {state});
-         break;
-      case GLFW_KEY_4:
-         interact.SetArgument(Keys::Main4 {state});
-         break;
-      case GLFW_KEY_5:
-         interact.SetArgument(Keys::Main5 {state});
-         break;
-      case GLFW_KEY_6:
-         interact.SetArgument(Keys::Main6 {state});
-         break;
-      case GLFW_KEY_7:
-         interact.SetArgument(Keys::Main7 {state});
-         break;
-      case GLFW_KEY_8:
-         interact.SetArgument(Keys::Main8 {state});
-         break;
-      case GLFW_KEY_9:
-         interact.SetArgument(Keys::Main9 {state});
-         break;
-
-      case GLFW_KEY_A:
-         interact.SetArgument(Keys::A {state});
-         break;
-      case GLFW_KEY_B:
-         interact.SetArgument(Keys::B {state});
-         break;
-      case GLFW_KEY_C:
-         interact.SetArgument(Keys::C {state});
-         break;
-      case GLFW_KEY_D:
-         interact.SetArgument(Keys::D {state});
-         break;
-      case GLFW_KEY_E:
-         interact.SetArgument(Keys::E {state});
-         break;
-      case GLFW_KEY_F:
-         interact.SetArgument(Keys::F {state});
-         break;
-      case GLFW_KEY_G:
-         interact.SetArgument(Keys::G {state});
-         break;
-      case GLFW_KEY_H:
-         interact.SetArgument(Keys::H {state});
-         break;
-      case GLFW_KEY_I:
-         interact.SetArgument(Keys::I {state});
-         break;
-      case GLFW_KEY_J:
-         interact.SetArgument(Keys::J {state});
-         break;
-      case GLFW_KEY_K:
-         interact.SetArgument(Keys::K {state});
-         break;
-      case GLFW_KEY_L:
-         interact.SetArgument(Keys::L {state});
-         break;
-      case GLFW_KEY_M:
-         interact.SetArgument(Keys::M {state});
-         break;
-      case GLFW_KEY_N:
-         interact.SetArgument(Keys::N {state});
-         break;
-      case GLFW_KEY_O:
-         interact.SetArgument(Keys::O {state});
-         break;
-      case GLFW_KEY_P:
-         interact.SetArgument(Keys::P {state});
-         break;
-      case GLFW_KEY_Q:
-         interact.SetArgument(Keys::Q {state});
-         break;
-      case GLFW_KEY_R:
-         interact.SetArgument(Keys::R {state});
-         break;
-      case GLFW_KEY_S:
-         interact.SetArgument(Keys::S {state});
-         break;
-      case GLFW_KEY_T:
-         interact.SetArgument(Keys::T {state});
-         break;
-      case GLFW_KEY_U:
-         interact.SetArgument(Keys::U {state});
-         break;
-      case GLFW_KEY_V:
-         interact.SetArgument(Keys::V {state});
-         break;
-      case GLFW_KEY_W:
-         interact.SetArgument(Keys::W {state});
-         break;
-      case GLFW_KEY_X:
-         interact.SetArgument(Keys::X {state});
-         break;
-      case GLFW_KEY_Y:
-         interact.SetArgument(Keys::Y {state});
-         break;
-      case GLFW_KEY_Z:
-         interact.SetArgument(Keys::Z {state});
-         break;
-
-      case GLFW_KEY_ESCAPE:
-         interact.SetArgument(Keys::Escape {state});
-         break;
-      case GLFW_KEY_ENTER:
-         interact.SetArgument(Keys::Enter {state});
-         break;
-      case GLFW_KEY_TAB:
-         interact.SetArgument(Keys::Tab {state});
-         break;
-      case GLFW_KEY_BACKSPACE:
-         interact.SetArgument(Keys::Back {state});
-         break;
-      case GLFW_KEY_INSERT:
-         interact.SetArgument(Keys::Insert {state});
-         break;
-      case GLFW_KEY_DELETE:
-         interact.SetArgument(Keys::Delete {state});
-         break;
-      case GLFW_KEY_PAGE_UP:
-         interact.SetArgument(Keys::PageUp {state});
-         break;
-      case GLFW_KEY_PAGE_DOWN:
-         interact.SetArgument(Keys::PageDown {state});
-         break;
-      case GLFW_KEY_HOME:
-         interact.SetArgument(Keys::Home {state});
-         break;
-      case GLFW_KEY_END:
-         interact.SetArgument(Keys::End {state});
-         break;
-
-      case GLFW_KEY_LEFT:
-         interact.SetArgument(Keys::Left {state});
-         break;
-      case GLFW_KEY_RIGHT:
-         interact.SetArgument(Keys::Right {state});
-         break;
-      case GLFW_KEY_UP:
-         interact.SetArgument(Keys::Up {state});
-         break;
-      case GLFW_KEY_DOWN:
-         interact.SetArgument(Keys::Down {state});
-         break;
-
-      case GLFW_KEY_CAPS_LOCK:
-         interact.SetArgument(Keys::CapsLock {state});
-         break;
-      case GLFW_KEY_SCROLL_LOCK:
-         interact.SetArgument(Keys::ScrollLock {state});
-         break;
-      case GLFW_KEY_NUM_LOCK:
-         interact.SetArgument(Keys::NumLock {state});
-         break;
-      case GLFW_KEY_PRINT_SCREEN:
-         interact.SetArgument(Keys::Print {state});
-         break;
-      case GLFW_KEY_PAUSE:
-         interact.SetArgument(Keys::Pause {state});
-         break;
-
-      case GLFW_KEY_F1:
-         interact.SetArgument(Keys::F1 {state});
-         break;
-      case GLFW_KEY_F2:
-         interact.SetArgument(Keys::F2 {state});
-         break;
-      case GLFW_KEY_F3:
-         interact.SetArgument(Keys::F3 {state});
-         break;
-      case GLFW_KEY_F4:
-         interact.SetArgument(Keys::F4 {state});
-         break;
-      case GLFW_KEY_F5:
-         interact.SetArgument(Keys::F5 {state});
-         break;
-      case GLFW_KEY_F6:
-         interact.SetArgument(Keys::F6 {state});
-         break;
-      case GLFW_KEY_F7:
-         interact.SetArgument(Keys::F7 {state});
-         break;
-      case GLFW_KEY_F8:
-         interact.SetArgument(Keys::F8 {state});
-         break;
-      case GLFW_KEY_F9:
-         interact.SetArgument(Keys::F9 {state});
-         break;
-      case GLFW_KEY_F10:
-         interact.SetArgument(Keys::F10 {state});
-         break;
-      case GLFW_KEY_F11:
-         interact.SetArgument(Keys::F11 {state});
-         break;
-      case GLFW_KEY_F12:
-         interact.SetArgument(Keys::F12 {state});
-         break;
-      case GLFW_KEY_F13:
-         interact.SetArgument(Keys::F13 {state});
-         break;
-      case GLFW_KEY_F14:
-         interact.SetArgument(Keys::F14 {state});
-         break;
-      case GLFW_KEY_F15:
-         interact.SetArgument(Keys::F15 {state});
-         break;
-      case GLFW_KEY_F16:
-         interact.SetArgument(Keys::F16 {state});
-         break;
-      case GLFW_KEY_F17:
-         interact.SetArgument(Keys::F17 {state});
-         break;
-      case GLFW_KEY_F18:
-         interact.SetArgument(Keys::F18 {state});
-         break;
-      case GLFW_KEY_F19:
-         interact.SetArgument(Keys::F19 {state});
-         break;
-      case GLFW_KEY_F20:
-         interact.SetArgument(Keys::F20 {state});
-         break;
-      case GLFW_KEY_F21:
-         interact.SetArgument(Keys::F21 {state});
-         break;
-      case GLFW_KEY_F22:
-         interact.SetArgument(Keys::F22 {state});
-         break;
-      case GLFW_KEY_F23:
-         interact.SetArgument(Keys::F23 {state});
-         break;
-      case GLFW_KEY_F24:
-         interact.SetArgument(Keys::F24 {state});
-         break;
-
-      case GLFW_KEY_KP_0:
-         interact.SetArgument(Keys::Numpad0 {state});
-         break;
-      case GLFW_KEY_KP_1:
-         interact.SetArgument(Keys::Numpad1 {state});
-         break;
-      case GLFW_KEY_KP_2:
-         interact.SetArgument(Keys::Numpad2 {state});
-         break;
-      case GLFW_KEY_KP_3:
-         interact.SetArgument(Keys::Numpad3 {state});
-         break;
-      case GLFW_KEY_KP_4:
-         interact.SetArgument(Keys::Numpad4 {state});
-         break;
-      case GLFW_KEY_KP_5:
-         interact.SetArgument(Keys::Numpad5 {state});
-         break;
-      case GLFW_KEY_KP_6:
-         interact.SetArgument(Keys::Numpad6 {state});
-         break;
-      case GLFW_KEY_KP_7:
-         interact.SetArgument(Keys::Numpad7 {state});
-         break;
-      case GLFW_KEY_KP_8:
-         interact.SetArgument(Keys::Numpad8 {state});
-         break;
-      case GLFW_KEY_KP_9:
-         interact.SetArgument(Keys::Numpad9 {state});
-         break;
-
-      case GLFW_KEY_KP_EQUAL:
-         interact.SetArgument(Keys::NumpadEqual {state});
-         break;
-      case GLFW_KEY_KP_DECIMAL:
-         interact.SetArgument(Keys::NumpadDecimal {state});
-         break;
-      case GLFW_KEY_KP_DIVIDE:
-         interact.SetArgument(Keys::NumpadDivide {state});
-         break;
-      case GLFW_KEY_KP_MULTIPLY:
-         interact.SetArgument(Keys::NumpadMultiply {state});
-         break;
-      case GLFW_KEY_KP_SUBTRACT:
-         interact.SetArgument(Keys::NumpadSubtract {state});
-         break;
-      case GLFW_KEY_KP_ADD:
-         interact.SetArgument(Keys::NumpadAdd {state});
-         break;
-      case GLFW_KEY_KP_ENTER:
-         interact.SetArgument(Keys::NumpadEnter {state});
-         break;
-
-      case GLFW_KEY_LEFT_SHIFT:
-         interact.SetArgument(Keys::LeftShift {state});
-         break;
-      case GLFW_KEY_RIGHT_SHIFT:
-         interact.SetArgument(Keys::RightShift {state});
-         break;
-
-      case GLFW_KEY_LEFT_CONTROL:
-         interact.SetArgument(Keys::LeftControl {state});
-         break;
-      case GLFW_KEY_RIGHT_CONTROL:
-         interact.SetArgument(Keys::RightControl {state});
-         break;
-
-      case GLFW_KEY_LEFT_ALT:
-         interact.SetArgument(Keys::LeftAlt {state});
-         break;
-      case GLFW_KEY_RIGHT_ALT:
-         interact.SetArgument(Keys::RightAlt {state});
-         break;
-      default:
-         return;
-      }
-
-      canvas->RunIn<Seek::HereAndBelow>(interact);
+      if (const auto unit = GetInputUnit(window))
+         unit->Capture({RawEvent::Key, key, scancode, action, mods});
    }
 
    /// On window moved                                                        
@@ -665,12 +1116,8 @@ namespace GLFW
    ///   @param x - new position (horizontal screen offset in pixels)         
    ///   @param y - new position (vertical screen offset in pixels)           
    void OnMove(GLFWwindow* window, int x, int y) {
-      auto canvas = GetUnit(window);
-      if (not canvas->IsInteractable())
-         return;
-
-      Verbs::Interact interact {Events::WindowMove {Vec2(x, y)}};
-      canvas->RunIn<Seek::HereAndBelow>(interact);
+      if (const auto unit = GetInputUnit(window))
+         unit->Capture({RawEvent::Move, x, y});
    }
 
    /// On window resized                                                      
@@ -678,59 +1125,24 @@ namespace GLFW
    ///   @param x - new scale (width in pixels)                               
    ///   @param y - new scale (height in pixels)                              
    void OnResize(GLFWwindow* window, int x, int y) {
-      auto canvas = GetUnit(window);
-      if (not canvas->IsInteractable())
-         return;
-
-      // Update hierarchy                                               
-      canvas->SetSize(x, y);
-
-      Verbs::Interact interact {Events::WindowResize {Vec2(x, y)}};
-      canvas->RunIn<Seek::HereAndBelow>(interact);
+      if (const auto unit = GetInputUnit(window))
+         unit->Capture({RawEvent::Resize, x, y});
    }
 
    /// On window focused or not                                               
    ///   @param window - the event's owner                                    
    ///   @param focused - focused state                                       
    void OnFocus(GLFWwindow* window, int focused) {
-      auto canvas = GetUnit(window);
-      if (canvas->IsClosed())
-         return;
-
-      if (focused) {
-         Verbs::Interact interact {
-            Events::WindowFocus {canvas->GetNativeHandle()}
-         };
-         canvas->RunIn<Seek::HereAndBelow>(interact);
-      }
-      else {
-         Verbs::Interact interact {
-            Events::WindowUnfocus {canvas->GetNativeHandle()}
-         };
-         canvas->RunIn<Seek::HereAndBelow>(interact);
-      }
+      if (const auto unit = GetInputUnit(window))
+         unit->Capture({RawEvent::Focus, focused});
    }
 
    /// On window minimized or not                                             
    ///   @param window - the event's owner                                    
    ///   @param iconified - iconification state                               
    void OnMinimize(GLFWwindow* window, int iconified) {
-      auto canvas = GetUnit(window);
-      if (not canvas->IsInteractable())
-         return;
-
-      if (iconified) {
-         Verbs::Interact interact {
-            Events::WindowMinimize {canvas->GetNativeHandle()}
-         };
-         canvas->RunIn<Seek::HereAndBelow>(interact);
-      }
-      else {
-         Verbs::Interact interact {
-            Events::WindowMaximize {canvas->GetNativeHandle()}
-         };
-         canvas->RunIn<Seek::HereAndBelow>(interact);
-      }
+      if (const auto unit = GetInputUnit(window))
+         unit->Capture({RawEvent::Minimize, iconified});
    }
 
    /// On window resolution change                                            
@@ -738,36 +1150,16 @@ namespace GLFW
    ///   @param x - new resolution (width in pixels)                          
    ///   @param y - new resolution (height in pixels)                         
    void OnResolutionChange(GLFWwindow* window, int x, int y) {
-      auto canvas = GetUnit(window);
-      if (canvas->IsClosed())
-         return;
-
-      Verbs::Interact interact {
-         Events::WindowResolutionChange {Vec2(x, y)}
-      };
-      canvas->RunIn<Seek::HereAndBelow>(interact);
+      if (const auto unit = GetInputUnit(window))
+         unit->Capture({RawEvent::Resolution, x, y});
    }
 
    /// On mouse enter window                                                  
    ///   @param window - the event's owner                                    
    ///   @param entered - zero if leave, one if entered                       
    void OnHover(GLFWwindow* window, int entered) {
-      auto canvas = GetUnit(window);
-      if (not canvas->IsInteractable())
-         return;
-
-      if (entered) {
-         Verbs::Interact interact {
-            Events::WindowMouseHoverIn {canvas->GetNativeHandle()}
-         };
-         canvas->RunIn<Seek::HereAndBelow>(interact);
-      }
-      else {
-         Verbs::Interact interact {
-            Events::WindowMouseHoverOut {canvas->GetNativeHandle()}
-         };
-         canvas->RunIn<Seek::HereAndBelow>(interact);
-      }
+      if (const auto unit = GetUnit(window))
+         unit->Capture({RawEvent::Hover, entered});
    }
 
    /// On mouse key                                                           
@@ -775,57 +1167,27 @@ namespace GLFW
    ///   @param button - button that was pressed or realeased                 
    ///   @param action - the action that the button performed                 
    ///   @param mods - mods for button combinations                           
-   void OnMouseKey(GLFWwindow* window, int button, UNUSED() int action, UNUSED() int mods) {
-      auto canvas = GetUnit(window);
-      if (not canvas->IsInteractable())
-         return;
-
-      Verbs::Interact interact {};
-      EventState state;
-
-      switch (button) {
-      case GLFW_MOUSE_BUTTON_LEFT:
-         interact.SetArgument(Keys::LeftMouse {state});
-         break;
-      case GLFW_MOUSE_BUTTON_RIGHT:
-         interact.SetArgument(Keys::RightMouse {state});
-         break;
-      case GLFW_MOUSE_BUTTON_MIDDLE:
-         interact.SetArgument(Keys::MiddleMouse {state});
-         break;
-      case GLFW_MOUSE_BUTTON_4:
-         interact.SetArgument(Keys::Mouse4 {state});
-         break;
-      case GLFW_MOUSE_BUTTON_5:
-         interact.SetArgument(Keys::Mouse5 {state});
-         break;
-      case GLFW_MOUSE_BUTTON_6:
-         interact.SetArgument(Keys::Mouse6 {state});
-         break;
-      case GLFW_MOUSE_BUTTON_7:
-         interact.SetArgument(Keys::Mouse7 {state});
-         break;
-      case GLFW_MOUSE_BUTTON_8:
-         interact.SetArgument(Keys::Mouse8 {state});
-         break;
-      default:
-         return;
-      }
-
-      canvas->RunIn<Seek::HereAndBelow>(interact);
+   void OnMouseKey(GLFWwindow* window, int button, int action, int mods) {
+      if (const auto unit = GetUnit(window))
+         unit->Capture({RawEvent::MouseKey, button, action, mods});
    }
 
    /// Returns last written UTF-32 character, affected by mod keys, language  
    /// and all localization stuff on your platform                            
    ///   @param window - the event's owner                                    
    ///   @param codepoint - UTF-32 code point                                 
-   void OnTextInput(GLFWwindow* window, UNUSED() unsigned codepoint) {
-      auto canvas = GetUnit(window);
-      if (not canvas->IsInteractable())
-         return;
+   void OnTextInput(GLFWwindow* window, unsigned codepoint) {
+      if (const auto unit = GetUnit(window))
+         unit->Capture({RawEvent::Char, static_cast<int>(codepoint)});
+   }
 
-      //TODO
-      //canvas->PushTextInput(Text::FromCodepoint(codepoint));
+   /// On cursor moved                                                        
+   ///   @param window - the event's owner                                    
+   ///   @param x - new cursor position, relative to the window's left edge   
+   ///   @param y - new cursor position, relative to the window's top edge    
+   void OnMouseMove(GLFWwindow* window, double x, double y) {
+      if (const auto unit = GetUnit(window))
+         unit->Capture({RawEvent::MouseMove, x, y});
    }
 
    /// On mouse scroll (supports 2D scrolling)                                
@@ -833,11 +1195,8 @@ namespace GLFW
    ///   @param xoffset - the new mouse x position                            
    ///   @param yoffset - the new mouse y position                            
    void OnMouseScroll(GLFWwindow* window, double xoffset, double yoffset) {
-      auto canvas = GetUnit(window);
-      if (not canvas->IsInteractable())
-         return;
-
-      canvas->AccumulateScroll({xoffset, yoffset});
+      if (const auto unit = GetUnit(window))
+         unit->Capture({RawEvent::Scroll, xoffset, yoffset});
    }
 
    /// On file drop to window                                                 
@@ -845,16 +1204,8 @@ namespace GLFW
    ///   @param count - number of dropped files                               
    ///   @param paths - deep container with filenames                         
    void OnFileDrop(GLFWwindow* window, int count, const char** paths) {
-      auto canvas = GetUnit(window);
-      if (not canvas->IsInteractable())
-         return;
-
-      Events::WindowFileDrop dropped;
-      for (int i = 0; i < count; ++i)
-         dropped.mPayload << Text {paths[i]};
-
-      Verbs::Interact interact {dropped};
-      canvas->RunIn<Seek::HereAndBelow>(interact);
+      if (const auto unit = GetUnit(window))
+         unit->CaptureDrop(count, paths);
    }
 
 } // namespace GLFW
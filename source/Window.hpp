@@ -7,9 +7,17 @@
 ///                                                                           
 #pragma once
 #include "Cursor.hpp"
+#include "Recording.hpp"
+#include "Stats.hpp"
+#include "EventPool.hpp"
 #include <Math/Gradient.hpp>
 #include <Math/Vector.hpp>
 #include <Entity/Pin.hpp>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
 
 
 namespace GLFW
@@ -30,7 +38,7 @@ namespace GLFW
       LANGULUS(ABSTRACT) false;
       LANGULUS(PRODUCER) GLFW::Platform;
       LANGULUS_BASES(A::Window);
-      LANGULUS_VERBS(Verbs::Associate);
+      LANGULUS_VERBS(Verbs::Associate, Verbs::Select);
 
    private:
       // The window handle (GLFW specific)                              
@@ -41,54 +49,258 @@ namespace GLFW
       Traits::Size::Tag<Pin<Scale2>> mSize;
       // Whether or not cursor is enabled                               
       Traits::Cursor::Tag<Own<Cursor*>> mCursor;
+      // Native cursor currently set for the window                     
+      GLFWcursor* mCurrentCursor {};
       // Whether or not fullscreen is enabled on a specific monitor     
       Traits::Monitor::Tag<Own<Monitor*>> mMonitor;
+      // Window position before going fullscreen                        
+      int mWindowedPosition[2] {};
       // Native window handle, used by other modules, like Vulkan       
       Traits::NativeWindowHandle::Tag<Own<void*>> mNativeWindowHandle;
 
 
+      // Raw events captured by the GLFW callbacks, possibly on another 
+      // thread, and processed on Update                                
+      TInputRing<RawEvent, 1024> mInput;
+      // Number of raw events dropped, because the ring was full        
+      ::std::atomic<Count> mInputOverflow = 0;
+      // File paths captured by drop callbacks, waiting to be processed.
+      // They can't go through the ring, because they're not fixed size 
+      ::std::mutex mDropMutex;
+      ::std::deque<::std::unique_ptr<FileDrop>> mDropStaging;
+      // Processed drops, whose paths are still being delivered         
+      ::std::deque<::std::unique_ptr<FileDrop>> mDrops;
+
+      // Records all processed raw events, if enabled                   
+      ::std::unique_ptr<InputRecorder> mRecorder;
+      // Feeds recorded raw events instead of the OS, if enabled        
+      ::std::unique_ptr<InputReplay> mReplay;
+
+      // The newest undelivered geometry change of each kind. Geometry  
+      // callbacks fire many times per frame while dragging, so only    
+      // the last value is delivered                                    
+      struct Geometry {
+         Vec2 mValue;
+         SteadyTime mTime;
+         bool mPending = false;
+      };
+
+      Geometry mPendingMove;
+      Geometry mPendingResize;
+      Geometry mPendingResolution;
+      // Resizes are delivered after the size doesn't change for this   
+      // long, so that expensive resize work runs once per settled size 
+      ::std::chrono::nanoseconds mResizeDebounce {};
+
       // Relative scrolling accumulator                                 
       Vec2 mScrollChange;
+      // Last cursor position, as reported by the cursor callback       
+      Vec2 mCursorPosition;
+      // Every cursor position and scroll sample since the last update, 
+      // up to a limit. Samples above the limit are counted and dropped 
+      static constexpr Count CursorHistorySize = 512;
+      ::std::array<CursorSample, CursorHistorySize> mCursorHistory;
+      Count mCursorHistoryCount = 0;
+      Count mCursorHistoryOverflow = 0;
+      // Whether the cursor is captured, and motion is reported relative
+      bool mRelativeMouse = false;
+      // Whether the cursor is shown, when it isn't captured            
+      bool mCursorVisible = true;
+      // Whether mCursorPosition can be used to compute relative motion 
+      bool mRelativeMotionValid = false;
+      // Relative motion accumulated since the last update              
+      Vec2 mRelativeMotion;
+      // Held keys and mouse buttons, with this frame's edges           
+      Traits::ButtonState::Tag<ButtonState> mButtons;
       // Mouse position, relative to window                             
       Traits::MousePosition::Tag<Grad2v2> mMousePosition;
       // Mouse scroll                                                   
       Traits::MouseScroll::Tag<Grad2v2> mMouseScroll;
-      // Text input accumulator                                         
+      // Text input accumulator, UTF-8 encoded, and the previously      
+      // dispatched one. The two are swapped after each dispatch        
       Text mTextInput;
-      // Clipboard                                                      
-      Traits::Clipboard::Tag<Text> mClipboard;
+      Text mTextSpare;
+      bool mTextDispatched = false;
+      // Events accumulated by the GLFW callbacks during polling, in the
+      // order they arrived. Dispatched as a single batch on Update     
+      TMany<Many> mEvents;
+      // Reusable event containers, so that queuing doesn't allocate    
+      EventPool mEventPool;
+      // When each queued event was received from the OS, in parallel   
+      // with mEvents                                                   
+      ::std::vector<SteadyTime> mEventTimes;
+      // Timing of the dispatched events, appended to each interact     
+      // verb. Reused once no verb references it                        
+      Many mTiming;
+      // Reusable list for dispatching events one at a time             
+      TMany<Many> mSingleEvent;
+      // Capture times of the newest samples, that produce events on    
+      // update rather than while processing                            
+      SteadyTime mLastMouseTime;
+      SteadyTime mLastScrollTime;
+      SteadyTime mLastTextTime;
+      // Event types that were dispatched at least once, and whether any
+      // unit in the hierarchy handled them. Used only if filtering is  
+      // enabled via Traits::FilterUnhandled, in which case events of   
+      // unhandled types are dropped before being queued. Reset on      
+      // Refresh, because the hierarchy might have changed              
+      // An event counts as handled only if a unit marks the interact   
+      // verb done - units that react to an event without calling Done  
+      // stop receiving it after its first dispatch                     
+      ::std::vector<::std::pair<DMeta, bool>> mSubscriptions;
+      bool mFilterUnhandled = false;
+      // Clipboard, fetched lazily from the system. Not reflected, so   
+      // that it's never read stale - use Select or GetClipboard        
+      Text mClipboard;
+      // Hash of the clipboard contents, used to detect changes         
+      Hash mClipboardHash;
+      // Incremented each time the clipboard contents change, so that   
+      // consumers can skip data they've already seen                   
+      Count mClipboardGeneration = 0;
+      // Whether clipboard might have changed outside of the window     
+      bool mClipboardStale = true;
+
+      // Window state, maintained while processing raw events, so that  
+      // checks never have to query the backend                         
+      bool mClosed = false;
+      bool mFocused = false;
+      bool mHovered = false;
+      bool mMinimized = false;
+      // Number of backend attribute queries, for profiling purposes    
+      Count mAttributeQueries = 0;
+      // Event and dispatch counters, for profiling purposes            
+      WindowStats mStats;
 
       LANGULUS_MEMBERS(
          &Window::mSize,
          &Window::mMousePosition,
+         &Window::mButtons,
          &Window::mMouseScroll,
          &Window::mTitle,
          &Window::mCursor,
          &Window::mMonitor,
-         &Window::mNativeWindowHandle,
-         &Window::mClipboard
+         &Window::mNativeWindowHandle
       );
 
+      void CreateNativeWindow();
+      int QueryAttribute(int);
+      void Process(const RawEvent&);
+      bool Accept(const RawEvent&, bool) noexcept;
+      void RecordCursor(CursorSample::Kind, const RawEvent&) noexcept;
+      void FetchClipboard();
+      NOD() bool IsUnhandled(DMeta) const noexcept;
+      NOD() bool Subscribed(DMeta) noexcept;
+      void Dispatch();
+      void Stamp(SteadyTime);
+      NOD() EventTiming& PrepareTiming(SteadyTime);
+      void Coalesce(Geometry&, const RawEvent&) noexcept;
+      void FlushGeometry();
+      void DeliverDrops();
+
    public:
       Window(GLFW::Platform*, Describe);
       ~Window();
 
       void Associate(Verb&);
+      void Select(Verb&);
       void Refresh();
 
-      NOD() bool IsClosed() const;
-      NOD() bool IsInFocus() const;
-      NOD() bool IsMouseOver() const;
-      NOD() bool IsInteractable() const;
+      NOD() bool IsClosed() const noexcept {
+         return mClosed;
+      }
+      NOD() bool IsInFocus() const noexcept {
+         return mFocused;
+      }
+      NOD() bool IsMouseOver() const noexcept {
+         return mHovered;
+      }
+      NOD() bool IsInteractable() const noexcept;
+      NOD() ::std::chrono::nanoseconds GetSettleTime() const noexcept;
 
       NOD() void* GetNativeHandle() const noexcept;
       NOD() Scale2 GetSize() const noexcept;
       NOD() bool IsMinimized() const noexcept;
+      NOD() const Text& GetClipboard();
+      NOD() Count GetClipboardGeneration() const noexcept;
+      NOD() Hash GetClipboardHash() const noexcept;
+      NOD() ::std::span<const CursorSample> GetCursorHistory() const noexcept;
+      NOD() Count GetAttributeQueries() const noexcept {
+         return mAttributeQueries;
+      }
+      NOD() const WindowStats& GetStats() const noexcept {
+         return mStats;
+      }
+      /// Text input received during the last update, UTF-8 encoded           
+      NOD() const Text& GetTextInput() const noexcept {
+         return mTextInput;
+      }
+      NOD() Count GetEventAllocations() const noexcept {
+         return mEventPool.GetAllocations();
+      }
+      NOD() const ButtonState& GetButtonState() const noexcept {
+         return *mButtons;
+      }
+      NOD() Count GetInputOverflow() const noexcept {
+         return mInputOverflow.load(::std::memory_order_relaxed);
+      }
+      /// Number of raw events that can be captured before the next update    
+      /// Call only from the thread that captures                             
+      NOD() Count GetInputSpace() const noexcept {
+         return mInput.GetSpace();
+      }
+      NOD() bool IsReplaying() const noexcept {
+         return mReplay != nullptr;
+      }
+      void DumpStats() const;
+
+      void StartRecording(const Text&);
+      void StopRecording();
+      void StartReplay(const Text&, bool realtime = true);
+      void StopReplay();
+
+      // Used by the GLFW callbacks, but also for injecting synthetic   
+      // events, so they're inlined, to be usable outside the module    
+      void Capture(const RawEvent&) noexcept;
+      void CaptureDrop(int, const char**);
 
       void Update();
       void SetSize(int, int);
+      void SetMonitor(Monitor*);
+      void SetCursor(Cursor*);
+      void SetRelativeMouse(bool);
+      void ForgetCursor(GLFWcursor*) noexcept;
+      template<class E>
+      void PushEvent(E&&);
+      void PushEvents(const TMany<Many>&, SteadyTime);
       void PushTextInput(const Text&);
+      void PushCodepoint(char32_t);
       void AccumulateScroll(const Vec2&) noexcept;
    };
 
+
+   /// Capture a raw event, to be processed on the next Update                
+   /// Safe to call from the thread that polls GLFW, while the window is      
+   /// being updated on another. Synthetic events go through here, too        
+   ///   @param raw - the raw event                                           
+   LANGULUS(INLINED)
+   void Window::Capture(const RawEvent& raw) noexcept {
+      if (not mInput.Push(raw))
+         ++mInputOverflow;
+   }
+
+   /// Capture a file drop, to be processed on the next Update                
+   /// The paths are valid only during the GLFW callback, so they are packed  
+   ///   @param count - number of dropped files                               
+   ///   @param paths - the dropped file paths                                
+   LANGULUS(INLINED)
+   void Window::CaptureDrop(int count, const char** paths) {
+      auto drop = ::std::make_unique<FileDrop>(count, paths);
+      {
+         const ::std::scoped_lock lock {mDropMutex};
+         mDropStaging.emplace_back(Move(drop));
+      }
+
+      Capture({RawEvent::Drop, count});
+   }
+
 } // namespace GLFW
\ No newline at end of file
@@ -0,0 +1,97 @@
+///                                                                           
+/// Langulus::Module::GLFW                                                    
+/// Copyright (c) 2015 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "Main.hpp"
+#include <Flow/Verbs/Interact.hpp>
+#include "../source/Keys.inl"
+#include <catch2/catch.hpp>
+
+using namespace GLFW;
+
+
+/// The old way of translating keys, kept for comparison                      
+///   @param key - the GLFW key code to translate                             
+///   @return the number of translated keys (zero or one)                     
+Count TranslateViaSwitch(int key) {
+   Verbs::Interact interact {};
+   EventState state;
+
+   #define LANGULUS_GLFW_CASE(code, name) \
+      case code: interact.SetArgument(Keys::name {state}); return 1;
+
+   switch (key) {
+   LANGULUS_GLFW_KEYS(LANGULUS_GLFW_CASE)
+   default:
+      return 0;
+   }
+
+   #undef LANGULUS_GLFW_CASE
+}
+
+/// The new way of translating keys                                           
+///   @param key - the GLFW key code to translate                             
+///   @return the number of translated keys (zero or one)                     
+Count TranslateViaTable(int key) {
+   TMany<Many> events;
+   return Inner::TranslateCode(
+      Inner::KeyboardTable, key, events, EventState {}) ? 1 : 0;
+}
+
+SCENARIO("Key translation", "[keys]") {
+   #define LANGULUS_GLFW_COUNT(code, name) + 1
+   constexpr Count MappedKeys = 0 LANGULUS_GLFW_KEYS(LANGULUS_GLFW_COUNT);
+   constexpr Count MappedButtons = 0 LANGULUS_GLFW_MOUSE_KEYS(LANGULUS_GLFW_COUNT);
+   #undef LANGULUS_GLFW_COUNT
+
+   GIVEN("All GLFW keyboard and mouse codes") {
+      WHEN("Translated via the compile-time tables") {
+         TMany<Many> keys, buttons;
+         for (int key = 0; key <= GLFW_KEY_LAST; ++key)
+            Inner::TranslateCode(Inner::KeyboardTable, key, keys, EventState {});
+         for (int key = 0; key <= GLFW_MOUSE_BUTTON_LAST; ++key)
+            Inner::TranslateCode(Inner::MouseTable, key, buttons, EventState {});
+
+         THEN("Every mapped code produces exactly one event, in order") {
+            REQUIRE(keys.GetCount() == MappedKeys);
+            REQUIRE(keys[0].Is<Keys::Space>());
+            REQUIRE(keys.Last().Is<Keys::RightAlt>());
+            REQUIRE(buttons.GetCount() == MappedButtons);
+            REQUIRE(buttons[0].Is<Keys::LeftMouse>());
+         }
+      }
+
+      WHEN("Codes outside the tables are translated") {
+         TMany<Many> events;
+         REQUIRE_FALSE(Inner::TranslateCode(
+            Inner::KeyboardTable, GLFW_KEY_UNKNOWN, events, EventState {}));
+         REQUIRE_FALSE(Inner::TranslateCode(
+            Inner::KeyboardTable, GLFW_KEY_LAST + 1, events, EventState {}));
+         REQUIRE_FALSE(Inner::TranslateCode(
+            Inner::MouseTable, GLFW_MOUSE_BUTTON_LAST + 1, events, EventState {}));
+
+         THEN("Nothing is produced") {
+            REQUIRE(events.GetCount() == 0);
+         }
+      }
+   }
+}
+
+SCENARIO("Key translation throughput", "[keys][!benchmark]") {
+   BENCHMARK("Translations via switch") {
+      Count translated = 0;
+      for (int key = 0; key <= GLFW_KEY_LAST; ++key)
+         translated += TranslateViaSwitch(key);
+      return translated;
+   };
+
+   BENCHMARK("Translations via table") {
+      Count translated = 0;
+      for (int key = 0; key <= GLFW_KEY_LAST; ++key)
+         translated += TranslateViaTable(key);
+      return translated;
+   };
+}
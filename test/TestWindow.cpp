@@ -7,6 +7,8 @@
 ///                                                                           
 #include "Main.hpp"
 #include <Langulus/Platform.hpp>
+#include <Flow/Verbs/Interact.hpp>
+#include "../source/Window.hpp"
 #include <catch2/catch.hpp>
 
 
@@ -52,3 +54,261 @@ SCENARIO("Window creation", "[window]") {
    }
 }
 
+SCENARIO("Window state queries", "[window]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A window that has been updated for a couple of frames") {
+      // Create root entity                                             
+      auto root = Thing::Root<false>("GLFW");
+      auto window = root.CreateUnit<A::Window>();
+      REQUIRE(window.GetCount() == 1);
+
+      auto glfw = static_cast<GLFW::Window*>(window.As<A::Window*>());
+      for (int frame = 0; frame != 3; ++frame)
+         root.Update({});
+
+      WHEN("Window state is queried repeatedly") {
+         const auto queries = glfw->GetAttributeQueries();
+         const bool focused = glfw->IsInFocus();
+         const bool hovered = glfw->IsMouseOver();
+         bool consistent = true;
+         for (int check = 0; check != 100; ++check) {
+            consistent &= not glfw->IsClosed();
+            consistent &= glfw->IsInFocus() == focused;
+            consistent &= glfw->IsMouseOver() == hovered;
+         }
+
+         THEN("No backend attribute queries are made") {
+            REQUIRE(glfw->GetAttributeQueries() == queries);
+            REQUIRE(consistent);
+         }
+      }
+
+      WHEN("A frame without any events is updated") {
+         const auto queries = glfw->GetAttributeQueries();
+         root.Update({});
+
+         THEN("No backend attribute queries are made") {
+            REQUIRE(glfw->GetAttributeQueries() == queries);
+         }
+      }
+
+      WHEN("Many frames are updated") {
+         const auto queries = glfw->GetAttributeQueries();
+         for (int frame = 0; frame != 100; ++frame)
+            root.Update({});
+
+         THEN("No backend attribute queries are made in steady state") {
+            REQUIRE(glfw->GetAttributeQueries() == queries);
+         }
+      }
+
+      // Check for memory leaks                                         
+      REQUIRE(memoryState.Assert());
+   }
+}
+
+SCENARIO("Synthetic input", "[window]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A window") {
+      // Create root entity                                             
+      auto root = Thing::Root<false>("GLFW");
+      auto window = root.CreateUnit<A::Window>();
+      REQUIRE(window.GetCount() == 1);
+
+      auto abstract = window.As<A::Window*>();
+      auto glfw = static_cast<GLFW::Window*>(abstract);
+
+      WHEN("Synthetic events are injected") {
+         glfw->Capture({GLFW::RawEvent::Focus, GLFW_TRUE});
+         glfw->Capture({GLFW::RawEvent::Key, GLFW_KEY_A, 0, GLFW_PRESS, 0});
+         glfw->Capture({GLFW::RawEvent::MouseKey, GLFW_MOUSE_BUTTON_LEFT, GLFW_PRESS, 0});
+         glfw->Capture({GLFW::RawEvent::MouseMove, 10.0, 20.0});
+         glfw->Capture({GLFW::RawEvent::Scroll, 0.0, 1.0});
+         glfw->Capture({GLFW::RawEvent::Resize, 320, 240});
+         const char* paths[] {"first.txt", "second.txt"};
+         glfw->CaptureDrop(2, paths);
+         root.Update({});
+
+         THEN("They go through the same path as the real callbacks") {
+            REQUIRE(abstract->GetSize() == Scale2 {320, 240});
+            REQUIRE_FALSE(abstract->IsMinimized());
+         }
+
+         THEN("Held keys and buttons are tracked, along with their edges") {
+            auto& buttons = glfw->GetButtonState();
+            const auto a = GLFW::ButtonState::Keys({GLFW_KEY_A});
+            const auto lmb = GLFW::ButtonState::Buttons({GLFW_MOUSE_BUTTON_LEFT});
+            REQUIRE(buttons.AllHeld(a));
+            REQUIRE(buttons.AllHeld(lmb));
+            REQUIRE(buttons.AnyPressed(a));
+            REQUIRE_FALSE(buttons.AnyHeld(GLFW::ButtonState::Keys({GLFW_KEY_B})));
+
+            glfw->Capture({GLFW::RawEvent::Key, GLFW_KEY_A, 0, GLFW_RELEASE, 0});
+            root.Update({});
+            REQUIRE_FALSE(buttons.AnyHeld(a));
+            REQUIRE_FALSE(buttons.AnyPressed(a));
+            REQUIRE(buttons.AnyReleased(a));
+            REQUIRE(buttons.AllHeld(lmb));
+         }
+
+         glfw->Capture({GLFW::RawEvent::Minimize, GLFW_TRUE});
+         root.Update({});
+
+         THEN("Window state changes accordingly") {
+            REQUIRE(abstract->IsMinimized());
+         }
+
+         THEN("Events are counted, and minimized input is ignored") {
+            auto& stats = glfw->GetStats();
+            glfw->Capture({GLFW::RawEvent::Resize, 640, 480});
+            root.Update({});
+            REQUIRE(stats.mEvents[GLFW::RawEvent::Key] == 1);
+            REQUIRE(stats.mEvents[GLFW::RawEvent::Resize] == 2);
+            REQUIRE(stats.mIgnored[GLFW::RawEvent::Resize] == 1);
+            REQUIRE(stats.mDispatch.mSamples > 0);
+         }
+      }
+
+      // Check for memory leaks                                         
+      REQUIRE(memoryState.Assert());
+   }
+}
+
+SCENARIO("Text input", "[window][text]") {
+   static Allocator::State memoryState;
+
+   GIVEN("Codepoints of every UTF-8 length") {
+      char utf8[4];
+
+      WHEN("Encoded") {
+         THEN("Each is encoded with the shortest sequence") {
+            REQUIRE(GLFW::EncodeUTF8(U'A', utf8) == 1);
+            REQUIRE(Token {utf8, 1} == "\x41");
+            REQUIRE(GLFW::EncodeUTF8(0x7F, utf8) == 1);
+            REQUIRE(GLFW::EncodeUTF8(0xE9, utf8) == 2);
+            REQUIRE(Token {utf8, 2} == "\xC3\xA9");
+            REQUIRE(GLFW::EncodeUTF8(0x7FF, utf8) == 2);
+            REQUIRE(GLFW::EncodeUTF8(0x20AC, utf8) == 3);
+            REQUIRE(Token {utf8, 3} == "\xE2\x82\xAC");
+            REQUIRE(GLFW::EncodeUTF8(0xFFFF, utf8) == 3);
+            REQUIRE(GLFW::EncodeUTF8(0x1F600, utf8) == 4);
+            REQUIRE(Token {utf8, 4} == "\xF0\x9F\x98\x80");
+            REQUIRE(GLFW::EncodeUTF8(0x10FFFF, utf8) == 4);
+            REQUIRE(Token {utf8, 4} == "\xF4\x8F\xBF\xBF");
+         }
+      }
+
+      WHEN("Surrogates and codepoints out of range are encoded") {
+         THEN("Nothing is encoded") {
+            REQUIRE(GLFW::EncodeUTF8(0xD800, utf8) == 0);
+            REQUIRE(GLFW::EncodeUTF8(0xDBFF, utf8) == 0);
+            REQUIRE(GLFW::EncodeUTF8(0xDC00, utf8) == 0);
+            REQUIRE(GLFW::EncodeUTF8(0xDFFF, utf8) == 0);
+            REQUIRE(GLFW::EncodeUTF8(0x110000, utf8) == 0);
+            REQUIRE(GLFW::EncodeUTF8(0xFFFFFFFF, utf8) == 0);
+         }
+      }
+   }
+
+   GIVEN("A focused window") {
+      // Create root entity                                             
+      auto root = Thing::Root<false>("GLFW");
+      auto window = root.CreateUnit<A::Window>();
+      auto glfw = static_cast<GLFW::Window*>(window.As<A::Window*>());
+      glfw->Capture({GLFW::RawEvent::Focus, GLFW_TRUE});
+      root.Update({});
+
+      WHEN("Characters are typed, including invalid ones") {
+         for (int codepoint : {0x41, 0xD800, 0xE9, 0x20AC, 0x110000, 0x1F600})
+            glfw->Capture({GLFW::RawEvent::Char, codepoint});
+         root.Update({});
+
+         THEN("Valid ones are accumulated as UTF-8, in order") {
+            REQUIRE(Token {glfw->GetTextInput()} ==
+               "\x41\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");
+         }
+
+         THEN("Text input is restarted on the next update") {
+            root.Update({});
+            REQUIRE_FALSE(glfw->GetTextInput());
+         }
+      }
+
+      // Check for memory leaks                                         
+      REQUIRE(memoryState.Assert());
+   }
+}
+
+/// A unit that handles every event it receives, like a typical consumer      
+struct Listener final : A::Unit {
+   LANGULUS(ABSTRACT) false;
+   LANGULUS_BASES(A::Unit);
+   LANGULUS_VERBS(Verbs::Interact);
+
+   Count mInteractions = 0;
+
+   void Interact(Verb& verb) {
+      ++mInteractions;
+      verb.Done();
+   }
+};
+
+SCENARIO("Steady state input", "[window]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A window that has already handled some input") {
+      // Everything is handled, so that no event is dropped as unhandled
+      Listener listener;
+      auto root = Thing::Root<false>("GLFW");
+      root.AddUnit(&listener);
+      auto window = root.CreateUnit<A::Window>();
+      auto glfw = static_cast<GLFW::Window*>(window.As<A::Window*>());
+
+      const auto frame = [&](int i) {
+         glfw->Capture({GLFW::RawEvent::Key, GLFW_KEY_A, 0, GLFW_PRESS, 0});
+         glfw->Capture({GLFW::RawEvent::Key, GLFW_KEY_A, 0, GLFW_RELEASE, 0});
+         glfw->Capture({GLFW::RawEvent::MouseMove, 10.0 + i, 20.0});
+         glfw->Capture({GLFW::RawEvent::Scroll, 0.0, 1.0});
+         glfw->Capture({GLFW::RawEvent::Char, 'h'});
+         glfw->Capture({GLFW::RawEvent::Char, 'i'});
+         root.Update({});
+      };
+
+      glfw->Capture({GLFW::RawEvent::Focus, GLFW_TRUE});
+      for (int i = 0; i < 10; ++i)
+         frame(i);
+
+      WHEN("The same kind of input keeps coming") {
+         Allocator::State steadyState;
+         const auto allocations = glfw->GetEventAllocations();
+         const auto interactions = listener.mInteractions;
+
+         // Text alternates between two buffers, that are reused        
+         frame(10);
+         const auto even = glfw->GetTextInput().GetRaw();
+         frame(11);
+         const auto odd = glfw->GetTextInput().GetRaw();
+         bool reused = true;
+         for (int i = 12; i < 112; ++i) {
+            frame(i);
+            reused &= glfw->GetTextInput().GetRaw() == (i % 2 ? odd : even);
+         }
+
+         THEN("Events are handled, reusing event containers and text") {
+            REQUIRE(listener.mInteractions > interactions);
+            REQUIRE(Token {glfw->GetTextInput()} == "hi");
+            REQUIRE(even != odd);
+            REQUIRE(reused);
+            REQUIRE(glfw->GetEventAllocations() == allocations);
+            REQUIRE(steadyState.Assert());
+         }
+      }
+
+      root.RemoveUnit(&listener);
+
+      // Check for memory leaks                                         
+      REQUIRE(memoryState.Assert());
+   }
+}